@@ -0,0 +1,218 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Engaged.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/TransformError.hpp"
+#include "gimo_ext/std_expected.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    enum class parse_error
+    {
+        empty,
+        invalid,
+        out_of_range
+    };
+
+    struct error_code
+    {
+        int value{};
+    };
+
+    using token = std::expected<std::string_view, parse_error>;
+
+    constexpr auto parse_number = [](std::string_view const str) noexcept -> std::expected<int, parse_error> {
+        if (str.empty())
+        {
+            return std::unexpected{parse_error::empty};
+        }
+
+        int number{};
+        for (char const c : str)
+        {
+            if (c < '0' || '9' < c)
+            {
+                return std::unexpected{parse_error::invalid};
+            }
+
+            number = 10 * number + (c - '0');
+        }
+
+        return number;
+    };
+
+    constexpr auto check_range = [](int const number) noexcept -> std::expected<int, parse_error> {
+        if (9999 < number)
+        {
+            return std::unexpected{parse_error::out_of_range};
+        }
+
+        return number;
+    };
+
+    constexpr auto scale = [](int const number) noexcept {
+        return 3 * number;
+    };
+
+    constexpr auto to_error_code = [](parse_error const error) noexcept {
+        return error_code{100 + static_cast<int>(error)};
+    };
+
+    struct hand_written_chain
+    {
+        static constexpr std::string_view name{"hand-written if"};
+
+        [[nodiscard]]
+        static std::expected<int, error_code> apply(std::string_view const str)
+        {
+            auto const number = parse_number(str);
+            if (!number)
+            {
+                return std::unexpected{to_error_code(number.error())};
+            }
+
+            auto const checked = check_range(*number);
+            if (!checked)
+            {
+                return std::unexpected{to_error_code(checked.error())};
+            }
+
+            return scale(*checked);
+        }
+    };
+
+    // The monadic operations of `std::expected` are not provided by all standard libraries, which support `std::expected`.
+#if 202211L <= __cpp_lib_expected
+    struct std_expected_chain
+    {
+        static constexpr std::string_view name{"std::expected"};
+
+        [[nodiscard]]
+        static std::expected<int, error_code> apply(std::string_view const str)
+        {
+            return parse_number(str)
+                .and_then(check_range)
+                .transform(scale)
+                .transform_error(to_error_code);
+        }
+    };
+#endif
+
+    struct gimo_chain
+    {
+#ifdef GIMO_CONFIG_FLATTEN_FORWARDING
+        static constexpr std::string_view name{"gimo (flattened)"};
+#else
+        static constexpr std::string_view name{"gimo"};
+#endif
+
+        [[nodiscard]]
+        static std::expected<int, error_code> apply(std::string_view const str)
+        {
+            static constexpr auto pipeline = gimo::and_then(parse_number)
+                                           | gimo::and_then(check_range)
+                                           | gimo::transform(scale)
+                                           | gimo::transform_error(to_error_code);
+
+            return pipeline.apply(gimo::engaged{token{str}});
+        }
+    };
+
+    constexpr std::size_t inputCount{1024u};
+
+    // Malformed tokens are scattered randomly, so that the branch predictor can not learn the pattern.
+    [[nodiscard]]
+    std::vector<std::string> make_inputs(std::int64_t const errorPercentage)
+    {
+        std::mt19937 generator{42u};
+        std::bernoulli_distribution isError{static_cast<double>(errorPercentage) / 100.};
+        std::uniform_int_distribution<int> number{0, 9999};
+        std::uniform_int_distribution<int> errorKind{0, 2};
+
+        std::vector<std::string> inputs{};
+        inputs.reserve(inputCount);
+        for (std::size_t i{}; i < inputCount; ++i)
+        {
+            if (!isError(generator))
+            {
+                inputs.emplace_back(std::to_string(number(generator)));
+            }
+            else
+            {
+                switch (errorKind(generator))
+                {
+                case 0:  inputs.emplace_back(); break;
+                case 1:  inputs.emplace_back("12a4"); break;
+                default: inputs.emplace_back("123456"); break;
+                }
+            }
+        }
+
+        return inputs;
+    }
+
+    template <typename Chain>
+    void ParseTokens(benchmark::State& state)
+    {
+        std::vector<std::string> const inputs = make_inputs(state.range(0));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (std::string const& str : inputs)
+            {
+                auto result = Chain::apply(str);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+    }
+
+    template <typename Chain>
+    void register_chain()
+    {
+        std::string name{"parse_tokens/"};
+        name += Chain::name;
+
+        benchmark::RegisterBenchmark(name.c_str(), &ParseTokens<Chain>)
+            ->ArgName("error%")
+            ->Arg(0)
+            ->Arg(10)
+            ->Arg(50)
+            ->Arg(90)
+            ->Arg(100);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    register_chain<hand_written_chain>();
+#if 202211L <= __cpp_lib_expected
+    register_chain<std_expected_chain>();
+#endif
+    register_chain<gimo_chain>();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -0,0 +1,192 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // The inputs are mostly engaged, but only a few of them pass the filter.
+    // Thus, the steps have opposite null-rates, which can not be expressed by a single hint for the whole pipeline.
+    constexpr auto filter = [](int const value) noexcept {
+        return 0 == value % 16 ? std::optional{value} : std::nullopt;
+    };
+
+    constexpr auto scale = [](int const value) noexcept {
+        return 3 * value + 1;
+    };
+
+    constexpr auto fallback = []() noexcept {
+        return std::optional{-1};
+    };
+
+    [[nodiscard]]
+    constexpr auto make_pipeline()
+    {
+        return gimo::and_then(filter)
+             | gimo::transform(scale)
+             | gimo::or_else(fallback);
+    }
+
+    struct hand_written_chain
+    {
+        static constexpr std::string_view name{"hand-written if"};
+
+        [[nodiscard]]
+        static std::optional<int> apply(std::optional<int> const& opt)
+        {
+            if (opt)
+            {
+                if (std::optional<int> const filtered = filter(*opt))
+                {
+                    return scale(*filtered);
+                }
+            }
+
+            return fallback();
+        }
+    };
+
+    struct plain_chain
+    {
+        static constexpr std::string_view name{"no hints"};
+
+        [[nodiscard]]
+        static std::optional<int> apply(std::optional<int> const& opt)
+        {
+            static constexpr auto pipeline = make_pipeline();
+
+            return pipeline.apply(opt);
+        }
+    };
+
+    struct expect_value_chain
+    {
+        static constexpr std::string_view name{"expect_value"};
+
+        [[nodiscard]]
+        static std::optional<int> apply(std::optional<int> const& opt)
+        {
+            static constexpr auto pipeline = gimo::expect_value(make_pipeline());
+
+            return pipeline.apply(opt);
+        }
+    };
+
+    struct expect_null_chain
+    {
+        static constexpr std::string_view name{"expect_null"};
+
+        [[nodiscard]]
+        static std::optional<int> apply(std::optional<int> const& opt)
+        {
+            static constexpr auto pipeline = gimo::expect_null(make_pipeline());
+
+            return pipeline.apply(opt);
+        }
+    };
+
+    // The hints as suggested by `gimo::suggest_expectations` for inputs with a low null-rate.
+    struct expect_steps_chain
+    {
+        static constexpr std::string_view name{"expect_steps<value, null, null>"};
+
+        [[nodiscard]]
+        static std::optional<int> apply(std::optional<int> const& opt)
+        {
+            static constexpr auto pipeline = gimo::expect_steps<
+                gimo::expectation::value,
+                gimo::expectation::null,
+                gimo::expectation::null>(make_pipeline());
+
+            return pipeline.apply(opt);
+        }
+    };
+
+    constexpr std::size_t inputCount{1024u};
+
+    // Null inputs are scattered randomly, so that the branch predictor can not learn the pattern.
+    [[nodiscard]]
+    std::vector<std::optional<int>> make_inputs(std::int64_t const nullPercentage)
+    {
+        std::mt19937 generator{42u};
+        std::bernoulli_distribution isNull{static_cast<double>(nullPercentage) / 100.};
+        std::uniform_int_distribution<int> value{0, 1 << 16};
+
+        std::vector<std::optional<int>> inputs(inputCount);
+        for (std::optional<int>& input : inputs)
+        {
+            if (!isNull(generator))
+            {
+                input = value(generator);
+            }
+        }
+
+        return inputs;
+    }
+
+    template <typename Chain>
+    void ApplyHinted(benchmark::State& state)
+    {
+        std::vector<std::optional<int>> const inputs = make_inputs(state.range(0));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (std::optional<int> const& input : inputs)
+            {
+                auto result = Chain::apply(input);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+    }
+
+    template <typename Chain>
+    void register_chain()
+    {
+        std::string name{"apply_hinted/"};
+        name += Chain::name;
+
+        benchmark::RegisterBenchmark(name.c_str(), &ApplyHinted<Chain>)
+            ->ArgName("null%")
+            ->Arg(0)
+            ->Arg(1)
+            ->Arg(10)
+            ->Arg(50)
+            ->Arg(90);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    register_chain<hand_written_chain>();
+    register_chain<plain_chain>();
+    register_chain<expect_value_chain>();
+    register_chain<expect_null_chain>();
+    register_chain<expect_steps_chain>();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -3,10 +3,19 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
+#include "gimo/Batch.hpp"
+#include "gimo/NullableColumn.hpp"
+#include "gimo/Parallel.hpp"
 #include "gimo/Pipeline.hpp"
 #include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
 #include "gimo_ext/std_optional.hpp"
 
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
 #define ANKERL_NANOBENCH_IMPLEMENT
 #include <nanobench.h>
 
@@ -55,6 +64,167 @@ namespace
                 ankerl::nanobench::doNotOptimizeAway(r);
             });
     }
+
+    auto make_batch(std::size_t const count, unsigned const seed)
+    {
+        std::mt19937 generator{seed};
+        std::bernoulli_distribution isEngaged{0.5};
+        std::uniform_int_distribution value{-1000, 1000};
+
+        std::vector<std::optional<int>> inputs(count);
+        for (auto& opt : inputs)
+        {
+            if (isEngaged(generator))
+            {
+                opt = value(generator);
+            }
+        }
+
+        return inputs;
+    }
+
+    constexpr auto batchPipeline = gimo::transform([](int const x) { return static_cast<float>(x) + 1.f; })
+                                 | gimo::and_then([](float const x) { return 0.f <= x ? std::optional{x} : std::nullopt; })
+                                 | gimo::transform([](float const x) { return 2.f * x; });
+
+    void ElementWiseApplyLoop(ankerl::nanobench::Bench& bench, std::vector<std::optional<int>> const& inputs)
+    {
+        std::vector<std::optional<float>> outputs(inputs.size());
+
+        bench.run(
+            "gimo::apply - element-wise loop",
+            [&] {
+                std::size_t engaged{};
+                for (std::size_t i = 0u; i < inputs.size(); ++i)
+                {
+                    outputs[i] = gimo::apply(inputs[i], batchPipeline);
+                    if (outputs[i])
+                    {
+                        ++engaged;
+                    }
+                }
+
+                ankerl::nanobench::doNotOptimizeAway(engaged);
+                ankerl::nanobench::doNotOptimizeAway(outputs);
+            });
+    }
+
+    void GimoApplyBatch(ankerl::nanobench::Bench& bench, std::vector<std::optional<int>> const& inputs)
+    {
+        std::vector<std::optional<float>> outputs(inputs.size());
+
+        bench.run(
+            "gimo::apply_batch",
+            [&] {
+                std::size_t const engaged = gimo::apply_batch(std::span{inputs}, std::span{outputs}, batchPipeline);
+
+                ankerl::nanobench::doNotOptimizeAway(engaged);
+                ankerl::nanobench::doNotOptimizeAway(outputs);
+            });
+    }
+
+    void ApplyBatchThenPushBack(ankerl::nanobench::Bench& bench, std::vector<std::optional<int>> const& inputs)
+    {
+        std::vector<std::optional<float>> results(inputs.size());
+        std::vector<float> outputs{};
+        outputs.reserve(inputs.size());
+
+        bench.run(
+            "gimo::apply_batch + push_back",
+            [&] {
+                std::ignore = gimo::apply_batch(std::span{inputs}, std::span{results}, batchPipeline);
+                outputs.clear();
+                for (std::optional<float> const& opt : results)
+                {
+                    if (opt)
+                    {
+                        outputs.push_back(*opt);
+                    }
+                }
+
+                ankerl::nanobench::doNotOptimizeAway(outputs);
+            });
+    }
+
+    void GimoCompact(ankerl::nanobench::Bench& bench, std::vector<std::optional<int>> const& inputs)
+    {
+        std::vector<float> outputs(inputs.size());
+
+        bench.run(
+            "gimo::compact",
+            [&] {
+                std::size_t const written = gimo::compact(std::span{inputs}, std::span{outputs}, batchPipeline);
+
+                ankerl::nanobench::doNotOptimizeAway(written);
+                ankerl::nanobench::doNotOptimizeAway(outputs);
+            });
+    }
+
+    auto make_column(std::vector<std::optional<int>> const& batch)
+    {
+        gimo::nullable_column<float> column{};
+        column.reserve(batch.size());
+        for (std::optional<int> const& opt : batch)
+        {
+            if (opt)
+            {
+                column.push_back(static_cast<float>(*opt));
+            }
+            else
+            {
+                column.push_back(std::nullopt);
+            }
+        }
+
+        return column;
+    }
+
+    void ColumnTransform(ankerl::nanobench::Bench& bench, gimo::nullable_column<float> const& column)
+    {
+        gimo::nullable_column<float> outputs{};
+        auto const pipeline = gimo::transform([](float const x) { return 2.f * x; })
+                            | gimo::transform([](float const x) { return x + 1.f; });
+
+        bench.run(
+            "gimo::apply_batch - nullable_column",
+            [&] {
+                std::size_t const engaged = gimo::apply_batch(column, outputs, pipeline);
+
+                ankerl::nanobench::doNotOptimizeAway(engaged);
+                ankerl::nanobench::doNotOptimizeAway(outputs);
+            });
+    }
+
+    void ColumnPureTransform(ankerl::nanobench::Bench& bench, gimo::nullable_column<float> const& column)
+    {
+        gimo::nullable_column<float> outputs{};
+        auto const pipeline = gimo::transform(gimo::pure([](auto const x) { return 2.f * x; }))
+                            | gimo::transform(gimo::pure([](auto const x) { return x + 1.f; }));
+
+        bench.run(
+            "gimo::apply_batch - nullable_column with gimo::pure",
+            [&] {
+                std::size_t const engaged = gimo::apply_batch(column, outputs, pipeline);
+
+                ankerl::nanobench::doNotOptimizeAway(engaged);
+                ankerl::nanobench::doNotOptimizeAway(outputs);
+            });
+    }
+
+    void GimoParallelApply(ankerl::nanobench::Bench& bench, std::vector<std::optional<int>> const& inputs, std::size_t const concurrency)
+    {
+        std::vector<std::optional<float>> outputs(inputs.size());
+        gimo::thread_pool pool{concurrency};
+
+        bench.run(
+            "gimo::parallel_apply - " + std::to_string(concurrency) + " thread(s)",
+            [&] {
+                std::size_t const engaged = gimo::parallel_apply(inputs, outputs, batchPipeline, pool);
+
+                ankerl::nanobench::doNotOptimizeAway(engaged);
+                ankerl::nanobench::doNotOptimizeAway(outputs);
+            });
+    }
 }
 
 int main()
@@ -71,4 +241,61 @@ int main()
     GimoAndThenChain(bench, 1);
     StdOptionalAndThenChain(bench, 2);
     GimoAndThenChain(bench, 2);
+
+    std::size_t constexpr batchSize{1'000'000u};
+    auto const batch = make_batch(batchSize, seed);
+    ankerl::nanobench::Bench batchBench{};
+    batchBench.title("batch of 1M std::optional<int>")
+        .relative(true)
+        .batch(batchSize)
+        .unit("element")
+        .warmup(3)
+        .minEpochIterations(10)
+        .performanceCounters(true);
+
+    ElementWiseApplyLoop(batchBench, batch);
+    GimoApplyBatch(batchBench, batch);
+
+    ankerl::nanobench::Bench compactBench{};
+    compactBench.title("compaction of 1M std::optional<int>")
+        .relative(true)
+        .batch(batchSize)
+        .unit("element")
+        .warmup(3)
+        .minEpochIterations(10)
+        .performanceCounters(true);
+
+    ApplyBatchThenPushBack(compactBench, batch);
+    GimoCompact(compactBench, batch);
+
+    auto const column = make_column(batch);
+    ankerl::nanobench::Bench columnBench{};
+    columnBench.title("transform over 1M nullable floats")
+        .relative(true)
+        .batch(batchSize)
+        .unit("element")
+        .warmup(3)
+        .minEpochIterations(10)
+        .performanceCounters(true);
+
+    ColumnTransform(columnBench, column);
+    ColumnPureTransform(columnBench, column);
+
+    for (std::size_t const count : {batchSize, 10u * batchSize})
+    {
+        auto const inputs = make_batch(count, seed);
+        ankerl::nanobench::Bench parallelBench{};
+        parallelBench.title("parallel batch of " + std::to_string(count / batchSize) + "M std::optional<int>")
+            .relative(true)
+            .batch(count)
+            .unit("element")
+            .warmup(3)
+            .minEpochIterations(10);
+
+        GimoApplyBatch(parallelBench, inputs);
+        for (std::size_t concurrency = 1u; concurrency <= gimo::thread_pool::default_concurrency(); concurrency *= 2u)
+        {
+            GimoParallelApply(parallelBench, inputs, concurrency);
+        }
+    }
 }
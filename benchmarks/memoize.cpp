@@ -0,0 +1,124 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Memoize.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // Stands in for an expensive lookup (e.g. a geo-IP lookup), which takes a few hundred nanoseconds.
+    constexpr auto expensive_lookup = [](int const key) noexcept -> std::optional<int> {
+        auto state = static_cast<std::uint64_t>(key);
+        for (int i{}; i < 256; ++i)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+        }
+
+        return 0 != state % 8u ? std::optional{static_cast<int>(state >> 40u)} : std::nullopt;
+    };
+
+    constexpr auto cheap_lookup = [](int const key) noexcept -> std::optional<int> {
+        return 0 != key % 8 ? std::optional{3 * key} : std::nullopt;
+    };
+
+    constexpr std::size_t capacity{4096u};
+    constexpr std::size_t inputCount{1u << 16u};
+
+    // The keys are drawn from a range of the given size, thus the hit rate drops, when that range exceeds the capacity.
+    [[nodiscard]]
+    std::vector<std::optional<int>> make_inputs(std::int64_t const keyCount)
+    {
+        std::mt19937 generator{42u};
+        std::uniform_int_distribution<int> key{0, static_cast<int>(keyCount) - 1};
+
+        std::vector<std::optional<int>> inputs(inputCount);
+        for (std::optional<int>& input : inputs)
+        {
+            input = key(generator);
+        }
+
+        return inputs;
+    }
+
+    template <typename Lookup>
+    void Direct(benchmark::State& state, Lookup lookup)
+    {
+        std::vector<std::optional<int>> const inputs = make_inputs(state.range(0));
+        auto const pipeline = gimo::and_then(lookup);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (std::optional<int> const& input : inputs)
+            {
+                auto result = pipeline.apply(input);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+    }
+
+    template <typename Lookup>
+    void Memoized(benchmark::State& state, Lookup lookup)
+    {
+        std::vector<std::optional<int>> const inputs = make_inputs(state.range(0));
+        auto const memoized = gimo::memoize(lookup, capacity);
+        auto const pipeline = gimo::and_then(memoized);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (std::optional<int> const& input : inputs)
+            {
+                auto result = pipeline.apply(input);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        gimo::memo_stats const stats = memoized.stats();
+        state.counters["hit%"] = 100. * static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses);
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+    }
+
+    template <typename Fn>
+    void register_benchmark(std::string const& name, Fn fn)
+    {
+        benchmark::RegisterBenchmark(name.c_str(), fn)
+            ->ArgName("keys")
+            ->Arg(256)
+            ->Arg(4096)
+            ->Arg(16384)
+            ->Arg(65536)
+            ->Arg(1 << 20);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    register_benchmark("expensive/direct", [](benchmark::State& state) { Direct(state, expensive_lookup); });
+    register_benchmark("expensive/memoized", [](benchmark::State& state) { Memoized(state, expensive_lookup); });
+    register_benchmark("cheap/direct", [](benchmark::State& state) { Direct(state, cheap_lookup); });
+    register_benchmark("cheap/memoized", [](benchmark::State& state) { Memoized(state, cheap_lookup); });
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -0,0 +1,240 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/pointers.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct leaf
+    {
+        int value{};
+    };
+
+    struct node
+    {
+        leaf data{};
+        std::ptrdiff_t next{-1};
+    };
+
+    constexpr std::size_t nodeCount{1024u};
+
+    // Links are scattered randomly, so that the branch predictor can not learn the pattern.
+    [[nodiscard]]
+    std::vector<node> make_nodes(std::int64_t const nullPercentage)
+    {
+        std::mt19937 generator{42u};
+        std::bernoulli_distribution isNull{static_cast<double>(nullPercentage) / 100.};
+        std::uniform_int_distribution<std::ptrdiff_t> target{0, nodeCount - 1};
+
+        std::vector<node> nodes(nodeCount);
+        for (std::size_t i{}; i < nodeCount; ++i)
+        {
+            nodes[i].data.value = static_cast<int>(i);
+            if (!isNull(generator))
+            {
+                nodes[i].next = target(generator);
+            }
+        }
+
+        return nodes;
+    }
+
+    // Each chain follows the link of a node and projects the value of the linked node's leaf.
+    template <typename Lookup>
+    [[nodiscard]]
+    constexpr auto make_pipeline(Lookup lookup)
+    {
+        return gimo::and_then([=](node const& n) { return lookup(n.next); })
+             | gimo::transform([](node const& n) -> leaf const& { return n.data; })
+             | gimo::transform([](leaf const& l) { return l.value; });
+    }
+
+    struct hand_written_chain
+    {
+        static constexpr std::string_view name{"hand-written if"};
+
+        std::vector<node> nodes;
+
+        [[nodiscard]]
+        node const* get(std::size_t const index) const noexcept
+        {
+            return &nodes[index];
+        }
+
+        [[nodiscard]]
+        std::optional<int> apply(node const* const handle) const
+        {
+            if (handle && 0 <= handle->next)
+            {
+                return nodes[static_cast<std::size_t>(handle->next)].data.value;
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    struct raw_pointer_chain
+    {
+        static constexpr std::string_view name{"T*"};
+
+        std::vector<node> nodes;
+
+        [[nodiscard]]
+        node const* get(std::size_t const index) const noexcept
+        {
+            return &nodes[index];
+        }
+
+        [[nodiscard]]
+        std::optional<int> apply(node const* const handle) const
+        {
+            auto const pipeline = make_pipeline(
+                [this](std::ptrdiff_t const index) -> node const* {
+                    return 0 <= index ? &nodes[static_cast<std::size_t>(index)] : nullptr;
+                });
+
+            return pipeline.apply(handle);
+        }
+    };
+
+    struct shared_ptr_chain
+    {
+        static constexpr std::string_view name{"std::shared_ptr"};
+
+        std::vector<std::shared_ptr<node const>> nodes;
+
+        [[nodiscard]]
+        std::shared_ptr<node const> const& get(std::size_t const index) const noexcept
+        {
+            return nodes[index];
+        }
+
+        [[nodiscard]]
+        std::optional<int> apply(std::shared_ptr<node const> const& handle) const
+        {
+            auto const pipeline = make_pipeline(
+                [this](std::ptrdiff_t const index) -> std::shared_ptr<node const> {
+                    return 0 <= index ? nodes[static_cast<std::size_t>(index)] : nullptr;
+                });
+
+            return pipeline.apply(handle);
+        }
+    };
+
+    struct optional_reference_wrapper_chain
+    {
+        static constexpr std::string_view name{"std::optional<std::reference_wrapper<T>>"};
+
+        std::vector<node> nodes;
+
+        [[nodiscard]]
+        std::optional<std::reference_wrapper<node const>> get(std::size_t const index) const noexcept
+        {
+            return std::cref(nodes[index]);
+        }
+
+        [[nodiscard]]
+        std::optional<int> apply(std::optional<std::reference_wrapper<node const>> const handle) const
+        {
+            auto const pipeline = gimo::and_then([this](node const& n) -> std::optional<std::reference_wrapper<node const>> {
+                                      if (0 <= n.next)
+                                      {
+                                          return std::cref(nodes[static_cast<std::size_t>(n.next)]);
+                                      }
+
+                                      return std::nullopt;
+                                  })
+                                | gimo::transform([](node const& n) { return std::cref(n.data); })
+                                | gimo::transform([](leaf const& l) { return l.value; });
+
+            return pipeline.apply(handle);
+        }
+    };
+
+    template <typename Chain>
+    [[nodiscard]]
+    Chain make_chain(std::vector<node> nodes)
+    {
+        if constexpr (requires { Chain{nodes}; })
+        {
+            return Chain{std::move(nodes)};
+        }
+        else
+        {
+            Chain chain{};
+            for (node const& n : nodes)
+            {
+                chain.nodes.emplace_back(std::make_shared<node const>(n));
+            }
+
+            return chain;
+        }
+    }
+
+    template <typename Chain>
+    void FollowLink(benchmark::State& state)
+    {
+        Chain const chain = make_chain<Chain>(make_nodes(state.range(0)));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (std::size_t i{}; i < nodeCount; ++i)
+            {
+                auto result = chain.apply(chain.get(i));
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(nodeCount));
+    }
+
+    template <typename Chain>
+    void register_chain()
+    {
+        std::string name{"follow_link/"};
+        name += Chain::name;
+
+        benchmark::RegisterBenchmark(name.c_str(), &FollowLink<Chain>)
+            ->ArgName("null%")
+            ->Arg(0)
+            ->Arg(10)
+            ->Arg(50)
+            ->Arg(90)
+            ->Arg(100);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    register_chain<hand_written_chain>();
+    register_chain<raw_pointer_chain>();
+    register_chain<shared_ptr_chain>();
+    register_chain<optional_reference_wrapper_chain>();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
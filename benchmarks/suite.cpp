@@ -0,0 +1,307 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    template <std::size_t size>
+    struct payload
+    {
+        std::array<std::uint8_t, size> bytes{};
+    };
+
+    template <typename T>
+    constexpr std::string_view payload_name{"int"};
+
+    template <std::size_t size>
+    constexpr std::string_view payload_name<payload<size>>{
+        16u == size    ? "payload<16>"
+        : 64u == size  ? "payload<64>"
+        : 256u == size ? "payload<256>"
+                       : "payload<?>"};
+
+    [[nodiscard]]
+    constexpr int bump(int const value) noexcept
+    {
+        return value + 1;
+    }
+
+    template <std::size_t size>
+    [[nodiscard]]
+    constexpr payload<size> bump(payload<size> value) noexcept
+    {
+        ++value.bytes.front();
+
+        return value;
+    }
+
+    enum class step_kind
+    {
+        and_then,
+        transform,
+        or_else,
+        mixed
+    };
+
+    [[nodiscard]]
+    constexpr std::string_view step_kind_name(step_kind const kind) noexcept
+    {
+        switch (kind)
+        {
+        case step_kind::and_then:  return "and_then";
+        case step_kind::transform: return "transform";
+        case step_kind::or_else:   return "or_else";
+        case step_kind::mixed:     return "mixed";
+        }
+
+        return "?";
+    }
+
+    // A mixed chain cycles through and_then, transform and or_else.
+    template <step_kind kind, std::size_t index>
+    constexpr step_kind step_kind_at = step_kind::mixed == kind
+                                         ? static_cast<step_kind>(index % 3u)
+                                         : kind;
+
+    template <typename T>
+    constexpr auto andThenStep = [](T const& value) { return std::optional<T>{bump(value)}; };
+
+    template <typename T>
+    constexpr auto transformStep = [](T const& value) { return bump(value); };
+
+    template <typename T>
+    constexpr auto orElseStep = [] { return std::optional<T>{T{}}; };
+
+    struct gimo_chain
+    {
+#ifdef GIMO_CONFIG_FLATTEN_FORWARDING
+        static constexpr std::string_view name{"gimo (flattened)"};
+#else
+        static constexpr std::string_view name{"gimo"};
+#endif
+
+        template <step_kind kind, typename T>
+        [[nodiscard]]
+        static constexpr auto make_step()
+        {
+            if constexpr (step_kind::and_then == kind)
+            {
+                return gimo::and_then(andThenStep<T>);
+            }
+            else if constexpr (step_kind::transform == kind)
+            {
+                return gimo::transform(transformStep<T>);
+            }
+            else
+            {
+                return gimo::or_else(orElseStep<T>);
+            }
+        }
+
+        template <step_kind kind, typename T, std::size_t... indices>
+        [[nodiscard]]
+        static constexpr auto make_pipeline([[maybe_unused]] std::index_sequence<indices...> const sequence)
+        {
+            return (make_step<step_kind_at<kind, indices>, T>() | ...);
+        }
+
+        template <step_kind kind, std::size_t length, typename T>
+        [[nodiscard]]
+        static std::optional<T> apply(std::optional<T> const& opt)
+        {
+            static constexpr auto pipeline = make_pipeline<kind, T>(std::make_index_sequence<length>{});
+
+            return pipeline.apply(opt);
+        }
+    };
+
+    struct hand_written_chain
+    {
+        static constexpr std::string_view name{"hand-written if"};
+
+        template <step_kind kind, typename T>
+        static constexpr void step(std::optional<T>& opt)
+        {
+            if constexpr (step_kind::and_then == kind)
+            {
+                if (opt)
+                {
+                    opt = andThenStep<T>(*opt);
+                }
+            }
+            else if constexpr (step_kind::transform == kind)
+            {
+                if (opt)
+                {
+                    *opt = transformStep<T>(*opt);
+                }
+            }
+            else
+            {
+                if (!opt)
+                {
+                    opt = orElseStep<T>();
+                }
+            }
+        }
+
+        template <step_kind kind, std::size_t length, typename T>
+        [[nodiscard]]
+        static std::optional<T> apply(std::optional<T> opt)
+        {
+            [&]<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const sequence) {
+                (step<step_kind_at<kind, indices>>(opt), ...);
+            }(std::make_index_sequence<length>{});
+
+            return opt;
+        }
+    };
+
+    struct std_optional_chain
+    {
+        static constexpr std::string_view name{"std::optional"};
+
+        template <step_kind kind, typename T>
+        [[nodiscard]]
+        static constexpr std::optional<T> step(std::optional<T>&& opt)
+        {
+            if constexpr (step_kind::and_then == kind)
+            {
+                return std::move(opt).and_then(andThenStep<T>);
+            }
+            else if constexpr (step_kind::transform == kind)
+            {
+                return std::move(opt).transform(transformStep<T>);
+            }
+            else
+            {
+                return std::move(opt).or_else(orElseStep<T>);
+            }
+        }
+
+        template <step_kind kind, std::size_t length, typename T>
+        [[nodiscard]]
+        static std::optional<T> apply(std::optional<T> opt)
+        {
+            [&]<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const sequence) {
+                ((opt = step<step_kind_at<kind, indices>>(std::move(opt))), ...);
+            }(std::make_index_sequence<length>{});
+
+            return opt;
+        }
+    };
+
+    constexpr std::size_t inputCount{1024u};
+
+    // Nulls are scattered randomly, so that the branch predictor can not learn the pattern.
+    template <typename T>
+    [[nodiscard]]
+    std::vector<std::optional<T>> make_inputs(std::int64_t const nullPercentage)
+    {
+        std::mt19937 generator{42u};
+        std::bernoulli_distribution isNull{static_cast<double>(nullPercentage) / 100.};
+
+        std::vector<std::optional<T>> inputs(inputCount);
+        for (std::optional<T>& opt : inputs)
+        {
+            if (!isNull(generator))
+            {
+                opt = T{};
+            }
+        }
+
+        return inputs;
+    }
+
+    template <typename Chain, step_kind kind, std::size_t length, typename T>
+    void ApplyChain(benchmark::State& state)
+    {
+        std::vector<std::optional<T>> const inputs = make_inputs<T>(state.range(0));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (std::optional<T> const& opt : inputs)
+            {
+                auto result = Chain::template apply<kind, length>(opt);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+    }
+
+    template <typename Chain, step_kind kind, std::size_t length, typename T>
+    void register_chain()
+    {
+        std::string name{step_kind_name(kind)};
+        name += "/";
+        name += payload_name<T>;
+        name += "/length:" + std::to_string(length);
+        name += "/";
+        name += Chain::name;
+
+        benchmark::RegisterBenchmark(name.c_str(), &ApplyChain<Chain, kind, length, T>)
+            ->ArgName("null%")
+            ->Arg(0)
+            ->Arg(10)
+            ->Arg(50)
+            ->Arg(90)
+            ->Arg(100);
+    }
+
+    template <step_kind kind, typename T>
+    void register_kind()
+    {
+        [&]<std::size_t... lengths>([[maybe_unused]] std::index_sequence<lengths...> const sequence) {
+            ((register_chain<hand_written_chain, kind, lengths, T>(),
+              register_chain<std_optional_chain, kind, lengths, T>(),
+              register_chain<gimo_chain, kind, lengths, T>()),
+             ...);
+        }(std::index_sequence<1u, 2u, 4u, 8u, 16u, 32u>{});
+    }
+
+    template <typename T>
+    void register_payload()
+    {
+        register_kind<step_kind::and_then, T>();
+        register_kind<step_kind::transform, T>();
+        register_kind<step_kind::or_else, T>();
+        register_kind<step_kind::mixed, T>();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    register_payload<int>();
+    register_payload<payload<16u>>();
+    register_payload<payload<64u>>();
+    register_payload<payload<256u>>();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
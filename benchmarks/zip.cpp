@@ -0,0 +1,168 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Pipeline.hpp"
+#include "gimo/Zip.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct sample
+    {
+        std::optional<int> x{};
+        std::optional<int> y{};
+        std::optional<int> z{};
+    };
+
+    constexpr auto combine = [](int const x, int const y, int const z) noexcept {
+        return 3 * x + 2 * y + z;
+    };
+
+    struct hand_written_chain
+    {
+        static constexpr std::string_view name{"hand-written if"};
+
+        [[nodiscard]]
+        static std::optional<int> apply(sample const& s)
+        {
+            if (s.x && s.y && s.z)
+            {
+                return combine(*s.x, *s.y, *s.z);
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    // Each input requires its own step and the earlier values must be captured by the nested lambdas.
+    struct nested_chain
+    {
+#ifdef GIMO_CONFIG_FLATTEN_FORWARDING
+        static constexpr std::string_view name{"nested and_then (flattened)"};
+#else
+        static constexpr std::string_view name{"nested and_then"};
+#endif
+
+        [[nodiscard]]
+        static std::optional<int> apply(sample const& s)
+        {
+            auto const pipeline = gimo::and_then([&](int const x) {
+                return gimo::and_then([&, x](int const y) {
+                           return gimo::transform([x, y](int const z) { return combine(x, y, z); })
+                               .apply(s.z);
+                       })
+                    .apply(s.y);
+            });
+
+            return pipeline.apply(s.x);
+        }
+    };
+
+    struct zip_chain
+    {
+#ifdef GIMO_CONFIG_FLATTEN_FORWARDING
+        static constexpr std::string_view name{"zip + transform_n (flattened)"};
+#else
+        static constexpr std::string_view name{"zip + transform_n"};
+#endif
+
+        [[nodiscard]]
+        static std::optional<int> apply(sample const& s)
+        {
+            static constexpr auto pipeline = gimo::transform_n(combine);
+
+            return pipeline.apply(gimo::zip(s.x, s.y, s.z));
+        }
+    };
+
+    constexpr std::size_t sampleCount{1024u};
+
+    // Missing inputs are scattered randomly, so that the branch predictor can not learn the pattern.
+    [[nodiscard]]
+    std::vector<sample> make_samples(std::int64_t const nullPercentage)
+    {
+        std::mt19937 generator{42u};
+        std::bernoulli_distribution isNull{static_cast<double>(nullPercentage) / 100.};
+        std::uniform_int_distribution<int> value{-1000, 1000};
+
+        auto const make = [&]() -> std::optional<int> {
+            if (isNull(generator))
+            {
+                return std::nullopt;
+            }
+
+            return value(generator);
+        };
+
+        std::vector<sample> samples(sampleCount);
+        for (sample& s : samples)
+        {
+            s.x = make();
+            s.y = make();
+            s.z = make();
+        }
+
+        return samples;
+    }
+
+    template <typename Chain>
+    void CombineSamples(benchmark::State& state)
+    {
+        std::vector<sample> const samples = make_samples(state.range(0));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (sample const& s : samples)
+            {
+                auto result = Chain::apply(s);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(samples.size()));
+    }
+
+    template <typename Chain>
+    void register_chain()
+    {
+        std::string name{"combine_samples/"};
+        name += Chain::name;
+
+        benchmark::RegisterBenchmark(name.c_str(), &CombineSamples<Chain>)
+            ->ArgName("null%")
+            ->Arg(0)
+            ->Arg(10)
+            ->Arg(50)
+            ->Arg(90);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    register_chain<hand_written_chain>();
+    register_chain<nested_chain>();
+    register_chain<zip_chain>();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -10,13 +10,24 @@
 
 #include "gimo/Config.hpp"
 
+#include "gimo/Batch.hpp"
 #include "gimo/Common.hpp"
+#include "gimo/Engaged.hpp"
+#include "gimo/FirstOf.hpp"
+#include "gimo/Instrumentation.hpp"
+#include "gimo/Memoize.hpp"
+#include "gimo/OptionalRef.hpp"
+#include "gimo/Parallel.hpp"
 #include "gimo/Pipeline.hpp"
+#include "gimo/Pure.hpp"
+#include "gimo/Simd.hpp"
+#include "gimo/Zip.hpp"
 
 #include "gimo/algorithm/BasicAlgorithm.hpp"
 
 #include "gimo/algorithm/AndThen.hpp"
 #include "gimo/algorithm/OrElse.hpp"
 #include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/TransformError.hpp"
 
 #endif
@@ -0,0 +1,202 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_BATCH_HPP
+#define GIMO_BATCH_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    template <typename Pipeline, typename Nullable, typename Out>
+    concept batch_applicable = applicable_pipeline<Pipeline>
+                            && nullable<Nullable>
+                            && requires(Out& out, Pipeline& steps, Nullable&& opt) {
+                                   out = steps.apply(std::forward<Nullable>(opt));
+                                   requires nullable<Out>;
+                               };
+
+    template <typename Pipeline, typename Nullable, typename Out>
+    concept compactable = applicable_pipeline<Pipeline>
+                       && nullable<Nullable>
+                       && requires(Out& out, Pipeline& steps, Nullable&& opt) {
+                              requires nullable<decltype(steps.apply(std::forward<Nullable>(opt)))>;
+                              out = gimo::value(steps.apply(std::forward<Nullable>(opt)));
+                          };
+
+    namespace detail
+    {
+        // Trivial values are selected rather than branched on, so that compilers may emit a conditional move.
+        template <typename Result, typename Out>
+        concept select_compactable = std::is_trivially_copyable_v<Out>
+                                  && std::is_trivially_copyable_v<std::remove_cvref_t<reference_type_t<Result>>>;
+
+        template <typename Pipeline, typename InIter, typename InSentinel, typename OutIter>
+        [[nodiscard]]
+        constexpr std::size_t compact(Pipeline& steps, InIter first, InSentinel const last, OutIter out)
+        {
+            std::size_t written{};
+            for (; first != last; ++first)
+            {
+                auto opt = steps.apply(*first);
+                if (detail::has_value(opt))
+                {
+                    *out = gimo::value(std::move(opt));
+                    ++out;
+                    ++written;
+                }
+            }
+
+            return written;
+        }
+
+        template <typename Pipeline, typename InIter, typename InSentinel, typename OutIter>
+        [[nodiscard]]
+        constexpr std::size_t apply_batch(Pipeline& steps, InIter first, InSentinel const last, OutIter out)
+        {
+            std::size_t engaged{};
+            for (; first != last; ++first, ++out)
+            {
+                auto& result = *out;
+                result = steps.apply(*first);
+                engaged += static_cast<std::size_t>(detail::has_value(result));
+            }
+
+            return engaged;
+        }
+    }
+
+    template <typename In, std::size_t inExtent, typename Out, std::size_t outExtent, typename Pipeline>
+        requires batch_applicable<Pipeline, In const&, Out>
+    [[nodiscard]]
+    constexpr std::size_t apply_batch(std::span<In const, inExtent> const inputs, std::span<Out, outExtent> const outputs, Pipeline&& steps)
+    {
+        GIMO_ASSERT(inputs.size() <= outputs.size(), "Output must be at least as large as the input.", inputs, outputs);
+
+        // The pipeline is always applied as lvalue, thus its steps are never moved from in between.
+        std::size_t engaged{};
+        std::size_t const count = inputs.size();
+        In const* const in = inputs.data();
+        Out* const out = outputs.data();
+        for (std::size_t i = 0u; i < count; ++i)
+        {
+            out[i] = steps.apply(in[i]);
+            engaged += static_cast<std::size_t>(detail::has_value(out[i]));
+        }
+
+        return engaged;
+    }
+
+    template <std::ranges::input_range Inputs, std::ranges::forward_range Outputs, typename Pipeline>
+        requires batch_applicable<Pipeline, std::ranges::range_reference_t<Inputs>, std::ranges::range_value_t<Outputs>>
+              && std::ranges::output_range<Outputs, std::ranges::range_value_t<Outputs>>
+    [[nodiscard]]
+    constexpr std::size_t apply_batch(Inputs&& inputs, Outputs&& outputs, Pipeline&& steps)
+    {
+        if constexpr (std::ranges::contiguous_range<Inputs>
+                      && std::ranges::sized_range<Inputs>
+                      && std::ranges::contiguous_range<Outputs>
+                      && std::ranges::sized_range<Outputs>)
+        {
+            return gimo::apply_batch(
+                std::span<std::remove_reference_t<std::ranges::range_reference_t<Inputs>> const>{inputs},
+                std::span{outputs},
+                steps);
+        }
+        else
+        {
+            if constexpr (std::ranges::sized_range<Inputs> && std::ranges::sized_range<Outputs>)
+            {
+                GIMO_ASSERT(
+                    std::ranges::size(inputs) <= std::ranges::size(outputs),
+                    "Output must be at least as large as the input.",
+                    inputs,
+                    outputs);
+            }
+
+            return detail::apply_batch(
+                steps,
+                std::ranges::begin(inputs),
+                std::ranges::end(inputs),
+                std::ranges::begin(outputs));
+        }
+    }
+
+    // Writes only the values of the engaged results densely into the outputs and returns the number of written values.
+    // The outputs must be at least as large as the inputs; elements beyond the returned count are left unchanged.
+    template <typename In, std::size_t inExtent, typename Out, std::size_t outExtent, typename Pipeline>
+        requires compactable<Pipeline, In const&, Out>
+    [[nodiscard]]
+    constexpr std::size_t compact(std::span<In const, inExtent> const inputs, std::span<Out, outExtent> const outputs, Pipeline&& steps)
+    {
+        GIMO_ASSERT(inputs.size() <= outputs.size(), "Output must be at least as large as the input.", inputs, outputs);
+
+        std::size_t written{};
+        std::size_t const count = inputs.size();
+        In const* const in = inputs.data();
+        Out* const out = outputs.data();
+        for (std::size_t i = 0u; i < count; ++i)
+        {
+            auto opt = steps.apply(in[i]);
+            if constexpr (detail::select_compactable<decltype(opt), Out>)
+            {
+                // As `written <= i` holds, the current slot is always in bounds.
+                // Null results write the slot's current content back, thus it remains unchanged.
+                bool const engaged = detail::has_value(opt);
+                Out const current = out[written];
+                out[written] = engaged
+                                 ? static_cast<Out>(gimo::value(std::move(opt)))
+                                 : current;
+                written += static_cast<std::size_t>(engaged);
+            }
+            else if (detail::has_value(opt))
+            {
+                out[written] = gimo::value(std::move(opt));
+                ++written;
+            }
+        }
+
+        return written;
+    }
+
+    template <std::ranges::input_range Inputs, std::ranges::forward_range Outputs, typename Pipeline>
+        requires compactable<Pipeline, std::ranges::range_reference_t<Inputs>, std::ranges::range_value_t<Outputs>>
+              && std::ranges::output_range<Outputs, std::ranges::range_value_t<Outputs>>
+    [[nodiscard]]
+    constexpr std::size_t compact(Inputs&& inputs, Outputs&& outputs, Pipeline&& steps)
+    {
+        if constexpr (std::ranges::contiguous_range<Inputs>
+                      && std::ranges::sized_range<Inputs>
+                      && std::ranges::contiguous_range<Outputs>
+                      && std::ranges::sized_range<Outputs>)
+        {
+            return gimo::compact(
+                std::span<std::remove_reference_t<std::ranges::range_reference_t<Inputs>> const>{inputs},
+                std::span{outputs},
+                steps);
+        }
+        else
+        {
+            return detail::compact(
+                steps,
+                std::ranges::begin(inputs),
+                std::ranges::end(inputs),
+                std::ranges::begin(outputs));
+        }
+    }
+}
+
+#endif
@@ -8,7 +8,11 @@
 
 #pragma once
 
+#include "gimo/Config.hpp"
+
 #include <concepts>
+#include <functional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -37,11 +41,62 @@ namespace gimo::detail
 
     template <typename T, typename U>
     [[nodiscard]]
-    constexpr auto&& forward_like(U&& x) noexcept
+    GIMO_DETAIL_INTRINSIC constexpr auto&& forward_like(U&& x) noexcept
     {
         return static_cast<const_ref_like_t<T, U>>(x);
     }
 
+    // Member-pointers are still delegated to `std::invoke`, but all other callables are invoked directly.
+    template <typename Fn, typename... Args>
+    GIMO_DETAIL_FLATTEN constexpr decltype(auto) invoke(Fn&& fn, Args&&... args)
+        noexcept(std::is_nothrow_invocable_v<Fn, Args...>)
+    {
+        if constexpr (std::is_member_pointer_v<std::remove_cvref_t<Fn>>)
+        {
+            return std::invoke(GIMO_DETAIL_FORWARD(fn), GIMO_DETAIL_FORWARD(args)...);
+        }
+        else
+        {
+            return GIMO_DETAIL_FORWARD(fn)(GIMO_DETAIL_FORWARD(args)...);
+        }
+    }
+
+    // Invokes the callable, when converted to its result type.
+    // As that conversion yields a prvalue, the result can be constructed in place, e.g. via `std::in_place`
+    // constructors, which even works for non-movable types.
+    template <typename Fn, typename... Args>
+    class deferred_invocation
+    {
+    public:
+        using result_type = std::invoke_result_t<Fn, Args...>;
+
+        [[nodiscard]]
+        explicit constexpr deferred_invocation(Fn&& fn, Args&&... args) noexcept
+            : m_Fn{GIMO_DETAIL_FORWARD(fn)},
+              m_Args{GIMO_DETAIL_FORWARD(args)...}
+        {
+        }
+
+        deferred_invocation(deferred_invocation const&) = delete;
+        deferred_invocation& operator=(deferred_invocation const&) = delete;
+        deferred_invocation(deferred_invocation&&) = delete;
+        deferred_invocation& operator=(deferred_invocation&&) = delete;
+
+        [[nodiscard]]
+        constexpr explicit(false) operator result_type() &&
+        {
+            return std::apply(
+                [&](Args&&... args) -> result_type {
+                    return detail::invoke(GIMO_DETAIL_FORWARD(m_Fn), GIMO_DETAIL_FORWARD(args)...);
+                },
+                std::move(m_Args));
+        }
+
+    private:
+        Fn&& m_Fn;
+        std::tuple<Args&&...> m_Args;
+    };
+
     template <typename T>
     concept referencable = std::is_reference_v<T&>;
 
@@ -105,18 +160,62 @@ namespace gimo
         { *std::forward<T>(closure) } -> detail::referencable;
     };
 
-    template <dereferencable T>
-    constexpr decltype(auto) value(T&& nullable)
+    namespace detail
     {
-        return *std::forward<T>(nullable);
+        template <typename T>
+        concept customized_value = requires(T&& obj) {
+            { traits<std::remove_cvref_t<T>>::value(std::forward<T>(obj)) } -> referencable;
+        };
+
+        template <typename T>
+        concept customized_has_value = requires(T const& obj) {
+            { traits<std::remove_cvref_t<T>>::has_value(obj) } -> boolean_testable;
+        };
+
+        template <typename T>
+        concept customized_null = requires {
+            requires null_for<decltype(traits<std::remove_cvref_t<T>>::null), std::remove_cvref_t<T>>;
+        };
+
+        template <typename T>
+        concept customized_error = requires(T&& obj) {
+            { traits<std::remove_cvref_t<T>>::error(std::forward<T>(obj)) } -> referencable;
+        };
     }
 
+    template <typename T>
+        requires detail::customized_value<T> || dereferencable<T>
+    GIMO_DETAIL_FLATTEN constexpr decltype(auto) value(T&& nullable)
+    {
+        if constexpr (detail::customized_value<T>)
+        {
+            return traits<std::remove_cvref_t<T>>::value(GIMO_DETAIL_FORWARD(nullable));
+        }
+        else
+        {
+            return *GIMO_DETAIL_FORWARD(nullable);
+        }
+    }
+
+    template <typename T>
+        requires detail::customized_error<T>
+    GIMO_DETAIL_FLATTEN constexpr decltype(auto) error(T&& nullable)
+    {
+        return traits<std::remove_cvref_t<T>>::error(GIMO_DETAIL_FORWARD(nullable));
+    }
+
+    // Nullables either have a dedicated null-value, or carry an error instead of their value (like `std::expected`).
+    // The latter must always customize `has_value`, as there is no null-value to compare with.
     template <typename T>
     concept nullable = requires(T&& obj) {
-        requires null_for<decltype(traits<std::remove_cvref_t<T>>::null), std::remove_cvref_t<T>>;
+        requires detail::customized_null<T>
+                     || (detail::customized_error<T> && detail::customized_has_value<T>);
         { value(std::forward<T>(obj)) } -> detail::referencable;
     };
 
+    template <typename T>
+    concept fallible = nullable<T> && detail::customized_error<T>;
+
     template <typename T, typename Nullable>
     concept rebindable_to = nullable<Nullable>
                          && requires(T&& obj) {
@@ -134,27 +233,100 @@ namespace gimo
     template <nullable Nullable, typename Value>
     using rebind_value_t = typename traits<std::remove_cvref_t<Nullable>>::template rebind_value<Value>;
 
+    template <fallible Nullable>
+    using error_type_t = decltype(error(std::declval<Nullable&&>()));
+
+    template <fallible Nullable, typename Error>
+    using rebind_error_t = typename traits<std::remove_cvref_t<Nullable>>::template rebind_error<Error>;
+
     namespace detail
     {
         template <nullable Nullable>
         [[nodiscard]]
-        constexpr auto construct_empty()
+        GIMO_DETAIL_FLATTEN constexpr auto construct_empty()
         {
             return Nullable{null_v<Nullable>};
         }
 
         template <typename Nullable>
         [[nodiscard]]
-        constexpr bool has_value(Nullable const& target)
+        GIMO_DETAIL_FLATTEN constexpr bool has_value(Nullable const& target)
         {
-            return target != null_v<Nullable>;
+            if constexpr (customized_has_value<Nullable>)
+            {
+                return static_cast<bool>(traits<std::remove_cvref_t<Nullable>>::has_value(target));
+            }
+            else
+            {
+                return target != null_v<Nullable>;
+            }
         }
 
         template <typename Nullable, typename Value>
         [[nodiscard]]
-        constexpr auto rebind_value(Value&& value)
+        GIMO_DETAIL_FLATTEN constexpr auto rebind_value(Value&& value)
+        {
+            return rebind_value_t<Nullable, Value>{GIMO_DETAIL_FORWARD(value)};
+        }
+
+        template <typename Nullable, typename Fn, typename... Args>
+        concept customized_construct_from_invoke = requires(Fn&& fn, Args&&... args) {
+            {
+                traits<std::remove_cvref_t<Nullable>>::construct_from_invoke(
+                    std::forward<Fn>(fn),
+                    std::forward<Args>(args)...)
+            } -> std::same_as<rebind_value_t<Nullable, std::invoke_result_t<Fn, Args...>>>;
+        };
+
+        template <typename Nullable, typename Ref>
+        concept customized_rebind_reference =
+            std::is_lvalue_reference_v<Ref>
+            && requires(Nullable&& source, Ref ref) {
+                   {
+                       traits<std::remove_cvref_t<Nullable>>::rebind_reference(std::forward<Nullable>(source), ref)
+                   } -> std::same_as<rebind_value_t<Nullable, Ref>>;
+               };
+
+        template <typename Nullable, typename Error>
+        concept customized_construct_from_error = requires(Error&& error) {
+            {
+                traits<std::remove_cvref_t<Nullable>>::construct_from_error(std::forward<Error>(error))
+            } -> std::same_as<std::remove_cvref_t<Nullable>>;
+        };
+
+        // Propagates the error of the source to the target.
+        // If the target can not carry that error, the error is dropped and the target is null instead.
+        template <nullable Target, fallible Source>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr auto construct_error(Source&& source)
+        {
+            if constexpr (customized_construct_from_error<Target, error_type_t<Source>>)
+            {
+                return traits<std::remove_cvref_t<Target>>::construct_from_error(gimo::error(GIMO_DETAIL_FORWARD(source)));
+            }
+            else
+            {
+                return detail::construct_empty<Target>();
+            }
+        }
+
+        // Constructs the rebound nullable from the result of the invocation.
+        // Traits may customize this via `construct_from_invoke`, so that the result is constructed in place.
+        template <typename Nullable, typename Fn, typename... Args>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr auto construct_from_invoke(Fn&& fn, Args&&... args)
         {
-            return rebind_value_t<Nullable, Value>{std::forward<Value>(value)};
+            if constexpr (customized_construct_from_invoke<Nullable, Fn, Args...>)
+            {
+                return traits<std::remove_cvref_t<Nullable>>::construct_from_invoke(
+                    GIMO_DETAIL_FORWARD(fn),
+                    GIMO_DETAIL_FORWARD(args)...);
+            }
+            else
+            {
+                return detail::rebind_value<Nullable>(
+                    detail::invoke(GIMO_DETAIL_FORWARD(fn), GIMO_DETAIL_FORWARD(args)...));
+            }
         }
     }
 }
@@ -11,4 +11,48 @@
     #define GIMO_ASSERT(condition, msg, ...) assert((condition) && msg)
 #endif
 
+// Define GIMO_CONFIG_EXPERIMENTAL_SIMD to let batch algorithms invoke pure actions with `std::experimental::native_simd`,
+// if they accept it. Otherwise, plain loops are emitted, which are left to the auto-vectorizer of the compiler.
+
+// Define GIMO_CONFIG_EXECUTION_POLICIES to let `gimo::parallel_apply` accept standard execution-policies.
+// This is opt-in, as some standard libraries require linking against an additional backend (e.g. TBB) then.
+
+// Define GIMO_CONFIG_FLATTEN_FORWARDING to force the internal forwarding layers (pipeline steps, algorithm hooks, etc.)
+// inline, even in unoptimized builds, and to replace `std::forward` and `std::invoke` by plain casts and calls.
+// Pipelines in debug-builds then perform similar to hand-written code, but those layers can no longer be stepped into.
+// The setting must be consistent across all translation units of a program.
+#ifdef GIMO_CONFIG_FLATTEN_FORWARDING
+    #if defined(__GNUC__) || defined(__clang__)
+        #define GIMO_DETAIL_FLATTEN [[gnu::always_inline, gnu::artificial]]
+        #define GIMO_DETAIL_INTRINSIC [[gnu::always_inline, gnu::artificial]]
+    #elif defined(_MSC_VER)
+        #define GIMO_DETAIL_FLATTEN __forceinline
+        #if __has_cpp_attribute(msvc::intrinsic)
+            #define GIMO_DETAIL_INTRINSIC [[msvc::intrinsic]]
+        #else
+            #define GIMO_DETAIL_INTRINSIC __forceinline
+        #endif
+    #endif
+
+    #define GIMO_DETAIL_FORWARD(x) static_cast<decltype(x)&&>(x)
+#else
+    #include <utility>
+    #define GIMO_DETAIL_FORWARD(x) std::forward<decltype(x)>(x)
+#endif
+
+#ifndef GIMO_DETAIL_FLATTEN
+    #define GIMO_DETAIL_FLATTEN
+    #define GIMO_DETAIL_INTRINSIC
+#endif
+
+// Marks functions, which are rarely executed (e.g. the null path of `gimo::expect_value` pipelines).
+// They are never inlined and may be placed apart from the hot code.
+#if defined(__GNUC__) || defined(__clang__)
+    #define GIMO_DETAIL_COLD [[gnu::cold, gnu::noinline]]
+#elif defined(_MSC_VER)
+    #define GIMO_DETAIL_COLD __declspec(noinline)
+#else
+    #define GIMO_DETAIL_COLD
+#endif
+
 #endif
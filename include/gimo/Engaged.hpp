@@ -0,0 +1,102 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_ENGAGED_HPP
+#define GIMO_ENGAGED_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    // Wraps a nullable, which is statically known to contain a value.
+    // Pipelines, which are applied on such a wrapper, skip the null-test of their first step.
+    // Actions of `and_then` and `or_else` may return it, so that the next step is executed without a null-test, too.
+    // The wrapper never appears in the results, as it is unwrapped by the algorithms.
+    template <nullable Nullable>
+        requires unqualified<Nullable>
+    class engaged
+    {
+    public:
+        using nullable_type = Nullable;
+
+        [[nodiscard]]
+        explicit constexpr engaged(Nullable opt) noexcept(std::is_nothrow_move_constructible_v<Nullable>)
+            : m_Nullable{std::move(opt)}
+        {
+            GIMO_ASSERT(detail::has_value(m_Nullable), "Nullable must contain a value.", m_Nullable);
+        }
+
+        [[nodiscard]]
+        constexpr Nullable& get() & noexcept
+        {
+            return m_Nullable;
+        }
+
+        [[nodiscard]]
+        constexpr Nullable const& get() const& noexcept
+        {
+            return m_Nullable;
+        }
+
+        [[nodiscard]]
+        constexpr Nullable&& get() && noexcept
+        {
+            return std::move(m_Nullable);
+        }
+
+        [[nodiscard]]
+        constexpr Nullable const&& get() const&& noexcept
+        {
+            return std::move(m_Nullable);
+        }
+
+    private:
+        Nullable m_Nullable;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        struct is_engaged
+            : public std::false_type
+        {
+        };
+
+        template <typename Nullable>
+        struct is_engaged<engaged<Nullable>>
+            : public std::true_type
+        {
+        };
+
+        template <typename T>
+        concept known_engaged = is_engaged<std::remove_cvref_t<T>>::value;
+
+        template <typename T>
+        struct unwrap_engaged
+        {
+            using type = T;
+        };
+
+        template <known_engaged T>
+        struct unwrap_engaged<T>
+        {
+            using type = typename std::remove_cvref_t<T>::nullable_type;
+        };
+
+        template <typename T>
+        using unwrap_engaged_t = typename unwrap_engaged<T>::type;
+
+        template <typename T>
+        concept pipeline_input = nullable<T> || known_engaged<T>;
+    }
+}
+
+#endif
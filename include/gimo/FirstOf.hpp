@@ -0,0 +1,281 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_FIRST_OF_HPP
+#define GIMO_FIRST_OF_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace gimo::detail
+{
+    template <typename... Sources>
+    class source_chain;
+}
+
+namespace gimo
+{
+    // Counts for each source of a `gimo::first_of` step, how often it provided the result.
+    // Source `i` has been queried `hits(0) + ... + hits(i - 1) + misses()` times less than the first one.
+    // The stats must outlive all steps, which record into them.
+    class source_stats
+    {
+    public:
+        [[nodiscard]]
+        explicit source_stats(std::size_t const sourceCount)
+            : m_SourceCount{sourceCount},
+              m_Hits{std::make_unique<std::atomic<std::uint64_t>[]>(sourceCount)}
+        {
+        }
+
+        source_stats(source_stats const&) = delete;
+        source_stats& operator=(source_stats const&) = delete;
+        source_stats(source_stats&&) = delete;
+        source_stats& operator=(source_stats&&) = delete;
+
+        [[nodiscard]]
+        std::size_t source_count() const noexcept
+        {
+            return m_SourceCount;
+        }
+
+        [[nodiscard]]
+        std::uint64_t hits(std::size_t const index) const noexcept
+        {
+            GIMO_ASSERT(index < m_SourceCount, "Source index out of range.");
+
+            return m_Hits[index].load(std::memory_order_relaxed);
+        }
+
+        // The number of queries, for which none of the sources provided a value.
+        [[nodiscard]]
+        std::uint64_t misses() const noexcept
+        {
+            return m_Misses.load(std::memory_order_relaxed);
+        }
+
+        void reset() noexcept
+        {
+            for (std::size_t i{}; i < m_SourceCount; ++i)
+            {
+                m_Hits[i].store(0u, std::memory_order_relaxed);
+            }
+
+            m_Misses.store(0u, std::memory_order_relaxed);
+        }
+
+    private:
+        template <typename... Sources>
+        friend class detail::source_chain;
+
+        std::size_t m_SourceCount;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> m_Hits;
+        std::atomic<std::uint64_t> m_Misses{};
+
+        void record_hit(std::size_t const index) noexcept
+        {
+            GIMO_ASSERT(index < m_SourceCount, "Source index out of range.");
+
+            m_Hits[index].fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        void record_miss() noexcept
+        {
+            m_Misses.fetch_add(1u, std::memory_order_relaxed);
+        }
+    };
+}
+
+namespace gimo::detail
+{
+    template <unqualified Lookup, unqualified Store>
+    class write_back_source
+    {
+    public:
+        template <typename LookupArg, typename StoreArg>
+        [[nodiscard]]
+        explicit constexpr write_back_source(LookupArg&& lookup, StoreArg&& store)
+            : m_Lookup{std::forward<LookupArg>(lookup)},
+              m_Store{std::forward<StoreArg>(store)}
+        {
+        }
+
+        template <typename Key>
+            requires std::invocable<Lookup const&, Key const&>
+        constexpr decltype(auto) operator()(Key const& key) const
+        {
+            return std::invoke(m_Lookup, key);
+        }
+
+        template <typename Key, typename Value>
+        constexpr void store(Key const& key, Value const& value) const
+        {
+            std::invoke(m_Store, key, value);
+        }
+
+    private:
+        [[no_unique_address]] Lookup m_Lookup;
+        [[no_unique_address]] Store m_Store;
+    };
+
+    template <typename Source>
+    struct is_write_back_source
+        : public std::false_type
+    {
+    };
+
+    template <typename Lookup, typename Store>
+    struct is_write_back_source<write_back_source<Lookup, Store>>
+        : public std::true_type
+    {
+    };
+
+    template <typename Key, typename Source>
+    using query_result_t = std::remove_cvref_t<std::invoke_result_t<Source const&, Key const&>>;
+
+    template <typename Key, typename... Sources>
+    concept queryable_sources = (std::invocable<Sources const&, Key const&> && ...)
+                             && nullable<query_result_t<Key, std::tuple_element_t<0u, std::tuple<Sources...>>>>
+                             && (std::same_as<
+                                     query_result_t<Key, std::tuple_element_t<0u, std::tuple<Sources...>>>,
+                                     query_result_t<Key, Sources>>
+                                 && ...);
+
+    // Queries the sources in order and stops at the first one, which provides a value.
+    template <typename... Sources>
+    class source_chain
+    {
+    public:
+        template <typename... Args>
+        [[nodiscard]]
+        explicit constexpr source_chain(source_stats* const stats, Args&&... sources)
+            : m_Stats{stats},
+              m_Sources{std::forward<Args>(sources)...}
+        {
+        }
+
+        template <typename Key>
+            requires queryable_sources<Key, Sources...>
+        constexpr auto operator()(Key const& key) const
+        {
+            return query<0u>(key);
+        }
+
+    private:
+        source_stats* m_Stats;
+        std::tuple<Sources...> m_Sources;
+
+        template <std::size_t index, typename Key>
+        [[nodiscard]]
+        constexpr auto query(Key const& key) const
+        {
+            auto result = std::invoke(std::get<index>(m_Sources), key);
+            if constexpr (index + 1u < sizeof...(Sources))
+            {
+                if (!detail::has_value(result))
+                {
+                    return query<index + 1u>(key);
+                }
+            }
+            else if (!detail::has_value(result))
+            {
+                if (m_Stats)
+                {
+                    m_Stats->record_miss();
+                }
+
+                // The last result is returned as-is, thus errors of the slowest source are propagated.
+                return result;
+            }
+
+            if (m_Stats)
+            {
+                m_Stats->record_hit(index);
+            }
+
+            write_back(key, std::as_const(result), std::make_index_sequence<index>{});
+
+            return result;
+        }
+
+        template <typename Key, typename Result, std::size_t... indices>
+        constexpr void write_back(
+            Key const& key,
+            Result const& result,
+            [[maybe_unused]] std::index_sequence<indices...> const earlier) const
+        {
+            (store_into(std::get<indices>(m_Sources), key, result), ...);
+        }
+
+        template <typename Source, typename Key, typename Result>
+        static constexpr void store_into(
+            [[maybe_unused]] Source const& source,
+            [[maybe_unused]] Key const& key,
+            [[maybe_unused]] Result const& result)
+        {
+            if constexpr (is_write_back_source<Source>::value)
+            {
+                source.store(key, gimo::value(result));
+            }
+        }
+    };
+}
+
+namespace gimo
+{
+    // Makes a source of `gimo::first_of` writable. Values, which are provided by later sources, are passed to the
+    // store-action together with the key, so that subsequent queries are answered by this (usually faster) source.
+    template <typename Lookup, typename Store>
+    [[nodiscard]]
+    constexpr auto with_write_back(Lookup&& lookup, Store&& store)
+    {
+        return detail::write_back_source<std::remove_cvref_t<Lookup>, std::remove_cvref_t<Store>>{
+            std::forward<Lookup>(lookup),
+            std::forward<Store>(store)};
+    }
+
+    // Queries the sources (e.g. caches and their backend) in order with the value of the input and yields the first
+    // engaged result. Later sources are not invoked, once a value has been found.
+    // All sources must return the same nullable. If none of them provides a value, the result of the last one is returned.
+    // Like `gimo::and_then`, nulls and errors of the input are propagated without querying any source.
+    template <typename First, typename... Others>
+        requires(!std::same_as<std::remove_cvref_t<First>, source_stats>)
+    [[nodiscard]]
+    constexpr auto first_of(First&& first, Others&&... others)
+    {
+        using Chain = detail::source_chain<std::remove_cvref_t<First>, std::remove_cvref_t<Others>...>;
+
+        return gimo::and_then(Chain{nullptr, std::forward<First>(first), std::forward<Others>(others)...});
+    }
+
+    // Additionally records, which source provided the result, so that the order of the sources can be tuned.
+    template <typename... Sources>
+        requires(0u < sizeof...(Sources))
+    [[nodiscard]]
+    auto first_of(source_stats& stats, Sources&&... sources)
+    {
+        GIMO_ASSERT(sizeof...(Sources) == stats.source_count(), "The stats must have an entry for each source.");
+
+        using Chain = detail::source_chain<std::remove_cvref_t<Sources>...>;
+
+        return gimo::and_then(Chain{&stats, std::forward<Sources>(sources)...});
+    }
+}
+
+#endif
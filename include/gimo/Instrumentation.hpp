@@ -0,0 +1,397 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_INSTRUMENTATION_HPP
+#define GIMO_INSTRUMENTATION_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gimo
+{
+    // The recorded data of a single step. Steps are indexed after fusion, thus fused transforms share one entry.
+    // The durations are measured from entering the step until the pipeline result is constructed, thus they
+    // include all subsequent steps. The time spent within a step is the difference to its successor.
+    struct step_report
+    {
+        std::uint64_t value_count{};
+        std::uint64_t null_count{};
+        std::uint64_t sample_count{};
+        std::chrono::nanoseconds sampled_duration{};
+    };
+
+    struct pipeline_report
+    {
+        std::string name{};
+        std::vector<step_report> steps{};
+    };
+}
+
+namespace gimo::detail
+{
+    struct step_stats
+    {
+        std::atomic<std::uint64_t> valueCount{};
+        std::atomic<std::uint64_t> nullCount{};
+        std::atomic<std::uint64_t> sampleCount{};
+        std::atomic<std::int64_t> sampledNanoseconds{};
+    };
+
+    class pipeline_stats
+    {
+    public:
+        [[nodiscard]]
+        explicit pipeline_stats(std::size_t const stepCount, std::uint64_t const sampleInterval)
+            : m_StepCount{stepCount},
+              m_SampleInterval{sampleInterval},
+              m_Steps{std::make_unique<step_stats[]>(stepCount)}
+        {
+        }
+
+        [[nodiscard]]
+        std::size_t step_count() const noexcept
+        {
+            return m_StepCount;
+        }
+
+        [[nodiscard]]
+        std::uint64_t sample_interval() const noexcept
+        {
+            return m_SampleInterval;
+        }
+
+        [[nodiscard]]
+        step_stats& step(std::size_t const index) noexcept
+        {
+            GIMO_ASSERT(index < m_StepCount, "Step index out of range.");
+
+            return m_Steps[index];
+        }
+
+        [[nodiscard]]
+        step_stats const& step(std::size_t const index) const noexcept
+        {
+            GIMO_ASSERT(index < m_StepCount, "Step index out of range.");
+
+            return m_Steps[index];
+        }
+
+    private:
+        std::size_t m_StepCount;
+        std::uint64_t m_SampleInterval;
+        std::unique_ptr<step_stats[]> m_Steps;
+    };
+
+    // Adds the elapsed time to the step, when destroyed. Steps, which are not sampled, have no stats attached.
+    class step_sample
+    {
+    public:
+        [[nodiscard]]
+        constexpr step_sample() noexcept = default;
+
+        [[nodiscard]]
+        explicit step_sample(step_stats& stats) noexcept
+            : m_Stats{&stats},
+              m_Start{std::chrono::steady_clock::now()}
+        {
+        }
+
+        step_sample(step_sample const&) = delete;
+        step_sample& operator=(step_sample const&) = delete;
+        step_sample(step_sample&&) = delete;
+        step_sample& operator=(step_sample&&) = delete;
+
+        constexpr ~step_sample() noexcept
+        {
+            if (m_Stats)
+            {
+                finish();
+            }
+        }
+
+    private:
+        step_stats* m_Stats{};
+        std::chrono::steady_clock::time_point m_Start{};
+
+        void finish() const noexcept
+        {
+            auto const elapsed = std::chrono::steady_clock::now() - m_Start;
+            m_Stats->sampleCount.fetch_add(1u, std::memory_order_relaxed);
+            m_Stats->sampledNanoseconds.fetch_add(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                std::memory_order_relaxed);
+        }
+    };
+
+    // Counts the taken paths with relaxed atomics and samples every n-th call of each path.
+    class step_probe
+    {
+    public:
+        static constexpr bool enabled{true};
+
+        using sample = step_sample;
+
+        [[nodiscard]]
+        explicit constexpr step_probe(pipeline_stats& stats) noexcept
+            : m_Stats{&stats}
+        {
+        }
+
+        template <std::size_t index>
+        [[nodiscard]]
+        step_sample enter(step_path const path) const noexcept
+        {
+            step_stats& stats = m_Stats->step(index);
+            std::atomic<std::uint64_t>& counter = step_path::value == path ? stats.valueCount : stats.nullCount;
+            std::uint64_t const previous = counter.fetch_add(1u, std::memory_order_relaxed);
+
+            if (std::uint64_t const interval = m_Stats->sample_interval();
+                0u != interval && 0u == previous % interval)
+            {
+                return step_sample{stats};
+            }
+
+            return step_sample{};
+        }
+
+    private:
+        pipeline_stats* m_Stats;
+    };
+}
+
+namespace gimo
+{
+    // Owns the recorded data of all instrumented pipelines, identified by their names.
+    // Pipelines with the same name share their data, thus they must consist of the same number of steps.
+    // The registry must outlive all pipelines, which are instrumented with it.
+    class probe_registry
+    {
+    public:
+        [[nodiscard]]
+        probe_registry() = default;
+
+        // Every `sampleInterval`-th call of each step path is timed. Zero disables the sampling.
+        [[nodiscard]]
+        explicit probe_registry(std::uint64_t const sampleInterval) noexcept
+            : m_SampleInterval{sampleInterval}
+        {
+        }
+
+        probe_registry(probe_registry const&) = delete;
+        probe_registry& operator=(probe_registry const&) = delete;
+        probe_registry(probe_registry&&) = delete;
+        probe_registry& operator=(probe_registry&&) = delete;
+
+        [[nodiscard]]
+        detail::pipeline_stats& stats(std::string_view const name, std::size_t const stepCount)
+        {
+            std::scoped_lock const lock{m_Mutex};
+
+            auto iter = m_Pipelines.find(name);
+            if (iter == m_Pipelines.end())
+            {
+                iter = m_Pipelines.emplace(
+                                      std::string{name},
+                                      std::make_unique<detail::pipeline_stats>(stepCount, m_SampleInterval))
+                           .first;
+            }
+
+            GIMO_ASSERT(stepCount == iter->second->step_count(), "Pipelines with the same name must have the same number of steps.");
+
+            return *iter->second;
+        }
+
+        // The counters are read individually, thus the report of concurrently used pipelines may be slightly inconsistent.
+        [[nodiscard]]
+        std::vector<pipeline_report> snapshot() const
+        {
+            std::scoped_lock const lock{m_Mutex};
+
+            std::vector<pipeline_report> reports{};
+            reports.reserve(m_Pipelines.size());
+            for (auto const& [name, stats] : m_Pipelines)
+            {
+                pipeline_report& report = reports.emplace_back(pipeline_report{.name = name});
+                report.steps.reserve(stats->step_count());
+                for (std::size_t i{}; i < stats->step_count(); ++i)
+                {
+                    detail::step_stats const& step = stats->step(i);
+                    report.steps.push_back(
+                        step_report{
+                            .value_count = step.valueCount.load(std::memory_order_relaxed),
+                            .null_count = step.nullCount.load(std::memory_order_relaxed),
+                            .sample_count = step.sampleCount.load(std::memory_order_relaxed),
+                            .sampled_duration = std::chrono::nanoseconds{step.sampledNanoseconds.load(std::memory_order_relaxed)}});
+                }
+            }
+
+            return reports;
+        }
+
+        void reset() noexcept
+        {
+            std::scoped_lock const lock{m_Mutex};
+
+            for (auto const& [name, stats] : m_Pipelines)
+            {
+                for (std::size_t i{}; i < stats->step_count(); ++i)
+                {
+                    detail::step_stats& step = stats->step(i);
+                    step.valueCount.store(0u, std::memory_order_relaxed);
+                    step.nullCount.store(0u, std::memory_order_relaxed);
+                    step.sampleCount.store(0u, std::memory_order_relaxed);
+                    step.sampledNanoseconds.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private:
+        std::uint64_t m_SampleInterval{};
+        mutable std::mutex m_Mutex{};
+        std::map<std::string, std::unique_ptr<detail::pipeline_stats>, std::less<>> m_Pipelines{};
+    };
+
+    namespace detail
+    {
+        template <typename Pipeline>
+        class instrumented_pipeline
+        {
+        public:
+            [[nodiscard]]
+            explicit constexpr instrumented_pipeline(Pipeline pipeline, pipeline_stats& stats)
+                : m_Pipeline{std::move(pipeline)},
+                  m_Probe{stats}
+            {
+            }
+
+            template <pipeline_input Nullable>
+            GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) &
+            {
+                return apply(*this, GIMO_DETAIL_FORWARD(opt));
+            }
+
+            template <pipeline_input Nullable>
+            GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) const&
+            {
+                return apply(*this, GIMO_DETAIL_FORWARD(opt));
+            }
+
+            template <pipeline_input Nullable>
+            GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) &&
+            {
+                return apply(std::move(*this), GIMO_DETAIL_FORWARD(opt));
+            }
+
+            template <pipeline_input Nullable>
+            GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) const&&
+            {
+                return apply(std::move(*this), GIMO_DETAIL_FORWARD(opt));
+            }
+
+            [[nodiscard]]
+            constexpr Pipeline const& pipeline() const& noexcept
+            {
+                return m_Pipeline;
+            }
+
+            [[nodiscard]]
+            constexpr Pipeline&& pipeline() && noexcept
+            {
+                return std::move(m_Pipeline);
+            }
+
+        private:
+            Pipeline m_Pipeline;
+            step_probe m_Probe;
+
+            template <typename Self, typename Nullable>
+            [[nodiscard]]
+            GIMO_DETAIL_FLATTEN static constexpr auto apply(Self&& self, Nullable&& opt)
+            {
+                return detail::apply_steps<no_expectations>(
+                    GIMO_DETAIL_FORWARD(self).m_Pipeline.steps(),
+                    GIMO_DETAIL_FORWARD(opt),
+                    self.m_Probe);
+            }
+        };
+
+        // Instrumented pipelines are intentionally not null-preserving, so that batch algorithms do not skip null inputs,
+        // which would otherwise be missing in the counters.
+        template <typename Pipeline>
+        struct is_applicable_pipeline<instrumented_pipeline<Pipeline>>
+            : public std::true_type
+        {
+        };
+    }
+
+    // Derives the expectation of each step from its recorded counters, which can then be passed to `gimo::expect_steps`.
+    // Steps, which took one path at least with the given ratio, expect that path. All others, and those which have
+    // never been entered, expect nothing.
+    [[nodiscard]]
+    inline std::vector<expectation> suggest_expectations(pipeline_report const& report, double const ratio = 0.9)
+    {
+        GIMO_ASSERT(0.5 < ratio && ratio <= 1., "The ratio must be in (0.5, 1].");
+
+        std::vector<expectation> expectations{};
+        expectations.reserve(report.steps.size());
+        for (step_report const& step : report.steps)
+        {
+            auto const total = static_cast<double>(step.value_count + step.null_count);
+            if (0u != step.value_count && ratio <= static_cast<double>(step.value_count) / total)
+            {
+                expectations.emplace_back(expectation::value);
+            }
+            else if (0u != step.null_count && ratio <= static_cast<double>(step.null_count) / total)
+            {
+                expectations.emplace_back(expectation::null);
+            }
+            else
+            {
+                expectations.emplace_back(expectation::none);
+            }
+        }
+
+        return expectations;
+    }
+
+    // Records for each step, how often it took the value and the null path, and samples its duration.
+    // This is only enabled, if GIMO_CONFIG_INSTRUMENTATION is defined. Otherwise, the pipeline is returned unchanged
+    // and the registry is not touched, thus instrumented pipelines may stay in production code at no cost.
+    // The returned object can be applied like a pipeline, but can not be composed any further.
+    template <typename... Steps>
+    [[nodiscard]]
+    constexpr auto instrument(
+        [[maybe_unused]] probe_registry& registry,
+        [[maybe_unused]] std::string_view const name,
+        Pipeline<Steps...> steps)
+    {
+#ifdef GIMO_CONFIG_INSTRUMENTATION
+        return detail::instrumented_pipeline<Pipeline<Steps...>>{
+            std::move(steps),
+            registry.stats(name, sizeof...(Steps))};
+#else
+        return steps;
+#endif
+    }
+}
+
+#endif
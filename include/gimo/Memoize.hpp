@@ -0,0 +1,347 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_MEMOIZE_HPP
+#define GIMO_MEMOIZE_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    struct memo_stats
+    {
+        std::uint64_t hits{};
+        std::uint64_t misses{};
+    };
+}
+
+namespace gimo::detail
+{
+    // Determines the parameter type of unary non-generic callables, so that the key of `gimo::memoize` can be deduced.
+    template <typename Action>
+    struct unary_argument
+    {
+    };
+
+    template <typename Action>
+        requires requires { &Action::operator(); }
+    struct unary_argument<Action>
+        : public unary_argument<decltype(&Action::operator())>
+    {
+    };
+
+    template <typename R, typename Arg>
+    struct unary_argument<R (*)(Arg)>
+    {
+        using type = Arg;
+    };
+
+    template <typename R, typename Arg>
+    struct unary_argument<R (*)(Arg) noexcept>
+    {
+        using type = Arg;
+    };
+
+    template <typename R, typename C, typename Arg>
+    struct unary_argument<R (C::*)(Arg)>
+    {
+        using type = Arg;
+    };
+
+    template <typename R, typename C, typename Arg>
+    struct unary_argument<R (C::*)(Arg) const>
+    {
+        using type = Arg;
+    };
+
+    template <typename R, typename C, typename Arg>
+    struct unary_argument<R (C::*)(Arg) noexcept>
+    {
+        using type = Arg;
+    };
+
+    template <typename R, typename C, typename Arg>
+    struct unary_argument<R (C::*)(Arg) const noexcept>
+    {
+        using type = Arg;
+    };
+
+    template <typename Action>
+    using unary_argument_t = std::remove_cvref_t<typename unary_argument<std::remove_cvref_t<Action>>::type>;
+
+    template <typename Key, typename Action>
+    struct memo_key
+    {
+        using type = Key;
+    };
+
+    template <typename Action>
+    struct memo_key<void, Action>
+    {
+        using type = unary_argument_t<Action>;
+    };
+
+    template <typename Hash, typename Key>
+    struct memo_hash
+    {
+        using type = Hash;
+    };
+
+    template <typename Key>
+    struct memo_hash<void, Key>
+    {
+        using type = std::hash<Key>;
+    };
+
+    // Some standard hashes (e.g. for integers) are the identity, thus the bits are mixed before they are split
+    // into the shard- and the slot-index.
+    [[nodiscard]]
+    constexpr std::uint64_t mix_hash(std::uint64_t hash) noexcept
+    {
+        hash ^= hash >> 33u;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33u;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33u;
+
+        return hash;
+    }
+
+    // A fixed-capacity, open-addressed cache, which is split into independently locked shards.
+    // Each key may only be stored within a small window after its home slot. If that window is full, the home slot
+    // is overwritten, thus the cache never grows and lookups never probe more than the window.
+    template <typename Key, typename Value, typename Hash>
+    class memo_cache
+    {
+    public:
+        static constexpr std::size_t shardCount{16u};
+        static constexpr std::size_t probeWindow{4u};
+
+        [[nodiscard]]
+        explicit memo_cache(std::size_t const capacity)
+            : m_SlotsPerShard{std::max<std::size_t>(probeWindow, (capacity + shardCount - 1u) / shardCount)},
+              m_Shards{std::make_unique<shard[]>(shardCount)}
+        {
+            for (std::size_t i{}; i < shardCount; ++i)
+            {
+                m_Shards[i].slots = std::make_unique<std::optional<entry>[]>(m_SlotsPerShard);
+            }
+        }
+
+        [[nodiscard]]
+        std::size_t capacity() const noexcept
+        {
+            return shardCount * m_SlotsPerShard;
+        }
+
+        template <typename Fn>
+        [[nodiscard]]
+        Value get_or_invoke(Key const& key, Fn&& fn)
+        {
+            std::uint64_t const hash = mix_hash(static_cast<std::uint64_t>(Hash{}(key)));
+            shard& target = m_Shards[hash >> 60u];
+            std::size_t const home = static_cast<std::size_t>(hash % m_SlotsPerShard);
+
+            {
+                std::scoped_lock const lock{target.mutex};
+                if (std::optional<entry> const* const slot = find(target, home, key))
+                {
+                    target.hits.fetch_add(1u, std::memory_order_relaxed);
+
+                    return (*slot)->value;
+                }
+            }
+
+            target.misses.fetch_add(1u, std::memory_order_relaxed);
+
+            // The lock is not held during the invocation, so that expensive actions do not block the whole shard.
+            // Concurrent misses of the same key thus invoke the action multiple times, but only store one result.
+            Value value = std::invoke(std::forward<Fn>(fn), key);
+
+            std::scoped_lock const lock{target.mutex};
+            if (find(target, home, key) == nullptr)
+            {
+                target.slots[free_slot(target, home)].emplace(key, value);
+            }
+
+            return value;
+        }
+
+        [[nodiscard]]
+        memo_stats stats() const noexcept
+        {
+            memo_stats result{};
+            for (std::size_t i{}; i < shardCount; ++i)
+            {
+                result.hits += m_Shards[i].hits.load(std::memory_order_relaxed);
+                result.misses += m_Shards[i].misses.load(std::memory_order_relaxed);
+            }
+
+            return result;
+        }
+
+        void clear()
+        {
+            for (std::size_t i{}; i < shardCount; ++i)
+            {
+                shard& target = m_Shards[i];
+                std::scoped_lock const lock{target.mutex};
+                for (std::size_t slot{}; slot < m_SlotsPerShard; ++slot)
+                {
+                    target.slots[slot].reset();
+                }
+
+                target.hits.store(0u, std::memory_order_relaxed);
+                target.misses.store(0u, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        struct entry
+        {
+            Key key;
+            Value value;
+
+            template <typename K, typename V>
+            [[nodiscard]]
+            explicit entry(K&& k, V&& v)
+                : key{std::forward<K>(k)},
+                  value{std::forward<V>(v)}
+            {
+            }
+        };
+
+        struct alignas(64) shard
+        {
+            std::mutex mutex{};
+            std::unique_ptr<std::optional<entry>[]> slots{};
+            std::atomic<std::uint64_t> hits{};
+            std::atomic<std::uint64_t> misses{};
+        };
+
+        std::size_t m_SlotsPerShard;
+        std::unique_ptr<shard[]> m_Shards;
+
+        [[nodiscard]]
+        std::optional<entry> const* find(shard const& target, std::size_t const home, Key const& key) const
+        {
+            for (std::size_t i{}; i < probeWindow; ++i)
+            {
+                std::optional<entry> const& slot = target.slots[(home + i) % m_SlotsPerShard];
+                if (slot && slot->key == key)
+                {
+                    return &slot;
+                }
+            }
+
+            return nullptr;
+        }
+
+        [[nodiscard]]
+        std::size_t free_slot(shard const& target, std::size_t const home) const noexcept
+        {
+            for (std::size_t i{}; i < probeWindow; ++i)
+            {
+                std::size_t const index = (home + i) % m_SlotsPerShard;
+                if (!target.slots[index])
+                {
+                    return index;
+                }
+            }
+
+            return home;
+        }
+    };
+
+    // The cache is shared between all copies, e.g. those made when a pipeline is composed.
+    template <unqualified Key, unqualified Action, typename Hash>
+    class memoized
+    {
+    public:
+        using key_type = Key;
+        using result_type = std::remove_cvref_t<std::invoke_result_t<Action const&, Key const&>>;
+
+        template <typename Arg>
+            requires std::constructible_from<Action, Arg&&>
+        [[nodiscard]]
+        explicit memoized(Arg&& action, std::size_t const capacity)
+            : m_Action{std::forward<Arg>(action)},
+              m_Cache{std::make_shared<cache_type>(capacity)}
+        {
+        }
+
+        result_type operator()(Key const& key) const
+        {
+            return m_Cache->get_or_invoke(key, m_Action);
+        }
+
+        [[nodiscard]]
+        std::size_t capacity() const noexcept
+        {
+            return m_Cache->capacity();
+        }
+
+        [[nodiscard]]
+        memo_stats stats() const noexcept
+        {
+            return m_Cache->stats();
+        }
+
+        // Removes all cached results and resets the stats.
+        void clear() const
+        {
+            m_Cache->clear();
+        }
+
+    private:
+        using cache_type = memo_cache<Key, result_type, Hash>;
+
+        [[no_unique_address]] Action m_Action;
+        std::shared_ptr<cache_type> m_Cache;
+    };
+}
+
+namespace gimo
+{
+    // Caches the results of an expensive, side-effect free action (e.g. for `gimo::and_then`), including null ones.
+    // The cache has a fixed capacity, thus older results are overwritten, when their slots are required otherwise.
+    // It is safe to be used concurrently, and all copies of the returned action share the same cache and stats.
+    // The key is deduced from the parameter of non-generic actions, but may also be specified explicitly.
+    // Keys are hashed via `std::hash`, unless another hash is specified.
+    template <typename Key = void, typename Hash = void, typename Action>
+    [[nodiscard]]
+    auto memoize(Action&& action, std::size_t const capacity)
+    {
+        using Actual = typename detail::memo_key<Key, Action>::type;
+        using ActualHash = typename detail::memo_hash<Hash, Actual>::type;
+        static_assert(
+            std::invocable<std::remove_cvref_t<Action> const&, Actual const&>,
+            "The action must be invocable with a const-ref to the key.");
+        static_assert(
+            std::copy_constructible<std::remove_cvref_t<std::invoke_result_t<std::remove_cvref_t<Action> const&, Actual const&>>>,
+            "The results of the action must be copyable.");
+
+        GIMO_ASSERT(0u < capacity, "The capacity must be greater than zero.");
+
+        return detail::memoized<Actual, std::remove_cvref_t<Action>, ActualHash>{std::forward<Action>(action), capacity};
+    }
+}
+
+#endif
@@ -0,0 +1,422 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_NULLABLE_COLUMN_HPP
+#define GIMO_NULLABLE_COLUMN_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/OptionalRef.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/Pure.hpp"
+#include "gimo/Simd.hpp"
+#include "gimo/algorithm/BasicAlgorithm.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gimo::detail
+{
+    struct column_access;
+
+    // Non-owning view onto a single element of a `nullable_column`.
+    // Assigning null rebinds the view itself and leaves the column untouched, like assigning `nullptr` to a pointer.
+    template <typename Column>
+    class column_element
+    {
+    public:
+        using value_type = typename std::remove_const_t<Column>::value_type;
+        using reference = std::conditional_t<std::is_const_v<Column>, value_type const&, value_type&>;
+
+        [[nodiscard]]
+        constexpr column_element() noexcept = default;
+
+        [[nodiscard]]
+        explicit(false) constexpr column_element([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+        }
+
+        [[nodiscard]]
+        explicit constexpr column_element(Column& column, std::size_t const index) noexcept
+            : m_Column{std::addressof(column)},
+              m_Index{index}
+        {
+        }
+
+        template <typename MutableColumn>
+            requires std::same_as<Column, MutableColumn const>
+        [[nodiscard]]
+        explicit(false) constexpr column_element(column_element<MutableColumn> const& other) noexcept
+            : m_Column{other.m_Column},
+              m_Index{other.m_Index}
+        {
+        }
+
+        constexpr column_element& operator=([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            m_Column = nullptr;
+
+            return *this;
+        }
+
+        [[nodiscard]]
+        constexpr bool has_value() const noexcept
+        {
+            return m_Column
+                && m_Column->is_valid(m_Index);
+        }
+
+        [[nodiscard]]
+        constexpr reference operator*() const noexcept
+        {
+            GIMO_ASSERT(has_value(), "Element must contain a value.");
+
+            return m_Column->values()[m_Index];
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(column_element const& element, [[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            return !element.has_value();
+        }
+
+    private:
+        template <typename>
+        friend class column_element;
+
+        Column* m_Column{};
+        std::size_t m_Index{};
+    };
+
+    inline constexpr std::size_t column_word_bits{64u};
+
+    [[nodiscard]]
+    constexpr std::size_t column_word_count(std::size_t const size) noexcept
+    {
+        return (size + column_word_bits - 1u) / column_word_bits;
+    }
+}
+
+template <typename Column>
+struct gimo::traits<gimo::detail::column_element<Column>>
+{
+    static constexpr auto null{std::nullopt};
+
+    [[nodiscard]]
+    static constexpr bool has_value(detail::column_element<Column> const& element) noexcept
+    {
+        return element.has_value();
+    }
+
+    template <typename V>
+    using rebind_value = detail::rebind_optional_t<V>;
+};
+
+namespace gimo
+{
+    // Stores its values densely and tracks the engagement of each element in a separate, packed bitmap.
+    template <unqualified T>
+        requires(!std::same_as<T, bool>)
+    class nullable_column
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using word_type = std::uint64_t;
+        using reference = detail::column_element<nullable_column>;
+        using const_reference = detail::column_element<nullable_column const>;
+
+        [[nodiscard]]
+        nullable_column() = default;
+
+        [[nodiscard]]
+        explicit nullable_column(size_type const count)
+            requires std::default_initializable<T>
+            : m_Values(count),
+              m_Validity(detail::column_word_count(count))
+        {
+        }
+
+        [[nodiscard]]
+        nullable_column(std::initializer_list<std::optional<T>> const elements)
+            requires std::default_initializable<T>
+        {
+            reserve(elements.size());
+            for (std::optional<T> const& element : elements)
+            {
+                if (element)
+                {
+                    push_back(*element);
+                }
+                else
+                {
+                    push_back(std::nullopt);
+                }
+            }
+        }
+
+        [[nodiscard]]
+        constexpr size_type size() const noexcept
+        {
+            return m_Values.size();
+        }
+
+        [[nodiscard]]
+        constexpr bool empty() const noexcept
+        {
+            return m_Values.empty();
+        }
+
+        void reserve(size_type const capacity)
+        {
+            m_Values.reserve(capacity);
+            m_Validity.reserve(detail::column_word_count(capacity));
+        }
+
+        void resize(size_type const count)
+            requires std::default_initializable<T>
+        {
+            // Elements beyond the new size must not leave stale bits behind.
+            for (size_type i = count; i < std::min(size(), detail::column_word_count(count) * detail::column_word_bits); ++i)
+            {
+                reset(i);
+            }
+
+            m_Values.resize(count);
+            m_Validity.resize(detail::column_word_count(count));
+        }
+
+        void push_back(T value)
+        {
+            grow();
+            m_Values.emplace_back(std::move(value));
+            set_bit(size() - 1u);
+        }
+
+        void push_back([[maybe_unused]] std::nullopt_t const null)
+            requires std::default_initializable<T>
+        {
+            grow();
+            m_Values.emplace_back();
+        }
+
+        [[nodiscard]]
+        constexpr bool is_valid(size_type const index) const noexcept
+        {
+            GIMO_ASSERT(index < size(), "Index out of bounds.", index);
+
+            return 0u != (m_Validity[index / detail::column_word_bits] & bit_mask(index));
+        }
+
+        void set(size_type const index, T value)
+        {
+            GIMO_ASSERT(index < size(), "Index out of bounds.", index);
+
+            m_Values[index] = std::move(value);
+            set_bit(index);
+        }
+
+        constexpr void reset(size_type const index) noexcept
+        {
+            GIMO_ASSERT(index < size(), "Index out of bounds.", index);
+
+            m_Validity[index / detail::column_word_bits] &= ~bit_mask(index);
+        }
+
+        [[nodiscard]]
+        constexpr size_type count_valid() const noexcept
+        {
+            size_type count{};
+            for (word_type const word : m_Validity)
+            {
+                count += static_cast<size_type>(std::popcount(word));
+            }
+
+            return count;
+        }
+
+        [[nodiscard]]
+        constexpr reference operator[](size_type const index) noexcept
+        {
+            GIMO_ASSERT(index < size(), "Index out of bounds.", index);
+
+            return reference{*this, index};
+        }
+
+        [[nodiscard]]
+        constexpr const_reference operator[](size_type const index) const noexcept
+        {
+            GIMO_ASSERT(index < size(), "Index out of bounds.", index);
+
+            return const_reference{*this, index};
+        }
+
+        // Values of null elements are unspecified.
+        [[nodiscard]]
+        constexpr std::span<T> values() noexcept
+        {
+            return m_Values;
+        }
+
+        [[nodiscard]]
+        constexpr std::span<T const> values() const noexcept
+        {
+            return m_Values;
+        }
+
+        // Bit `i % 64` of word `i / 64` denotes, whether element `i` contains a value.
+        [[nodiscard]]
+        constexpr std::span<word_type const> validity() const noexcept
+        {
+            return m_Validity;
+        }
+
+    private:
+        friend struct detail::column_access;
+
+        std::vector<T> m_Values{};
+        std::vector<word_type> m_Validity{};
+
+        [[nodiscard]]
+        static constexpr word_type bit_mask(size_type const index) noexcept
+        {
+            return word_type{1u} << (index % detail::column_word_bits);
+        }
+
+        void grow()
+        {
+            if (size() == m_Validity.size() * detail::column_word_bits)
+            {
+                m_Validity.emplace_back(0u);
+            }
+        }
+
+        constexpr void set_bit(size_type const index) noexcept
+        {
+            m_Validity[index / detail::column_word_bits] |= bit_mask(index);
+        }
+    };
+
+    namespace detail
+    {
+        struct column_access
+        {
+            template <typename T>
+            [[nodiscard]]
+            static constexpr std::vector<T>& values(nullable_column<T>& column) noexcept
+            {
+                return column.m_Values;
+            }
+
+            template <typename T>
+            [[nodiscard]]
+            static constexpr std::vector<std::uint64_t>& validity(nullable_column<T>& column) noexcept
+            {
+                return column.m_Validity;
+            }
+        };
+
+        template <typename Pipeline, typename In, typename Out>
+        struct is_unconditionally_transformable
+            : public std::false_type
+        {
+        };
+
+        // Only single transform steps are considered, as adjacent transforms are already fused into one.
+        template <typename Action, typename In, typename Out>
+        struct is_unconditionally_transformable<Pipeline<BasicAlgorithm<transform::traits, Action>>, In, Out>
+            : public std::bool_constant<
+                  is_pure_action<Action>::value
+                  && std::is_arithmetic_v<In>
+                  && std::is_arithmetic_v<Out>
+                  && std::convertible_to<std::invoke_result_t<Action const&, In const&>, Out>>
+        {
+        };
+
+        template <typename Pipeline, typename In>
+        using column_apply_result_t = std::remove_cvref_t<
+            decltype(std::declval<Pipeline&>().apply(std::declval<typename nullable_column<In>::const_reference>()))>;
+    }
+
+    // Processes the input word by word. If the pipeline is null-preserving, null inputs are skipped entirely.
+    // The output is resized to the size of the input and may be the input itself.
+    template <typename In, typename Out, applicable_pipeline Pipeline>
+        requires nullable<detail::column_apply_result_t<Pipeline, In>>
+              && std::assignable_from<Out&, reference_type_t<detail::column_apply_result_t<Pipeline, In>>>
+    [[nodiscard]]
+    std::size_t apply_batch(nullable_column<In> const& inputs, nullable_column<Out>& outputs, Pipeline&& steps)
+    {
+        std::vector<Out>& outValues = detail::column_access::values(outputs);
+        std::vector<std::uint64_t>& outValidity = detail::column_access::validity(outputs);
+        outValues.resize(inputs.size());
+        outValidity.resize(inputs.validity().size());
+
+        // Pure transforms on arithmetic types are applied to all values at once, so that the loop can be vectorized.
+        // As a transform always engages its result, the validity can be adopted as-is.
+        if constexpr (detail::is_unconditionally_transformable<std::remove_cvref_t<Pipeline>, In, Out>::value)
+        {
+            detail::transform_unconditionally(
+                inputs.values(),
+                std::span{outValues},
+                std::get<0>(std::as_const(steps).steps()).action());
+            // Copying a range onto itself is not allowed, thus columns, which are processed in place, are skipped.
+            if (outValidity.data() != inputs.validity().data())
+            {
+                std::ranges::copy(inputs.validity(), outValidity.begin());
+            }
+
+            return inputs.count_valid();
+        }
+
+        std::size_t engaged{};
+        std::span const inValidity = inputs.validity();
+        for (std::size_t wordIndex = 0u; wordIndex < inValidity.size(); ++wordIndex)
+        {
+            std::uint64_t pending = inValidity[wordIndex];
+            if constexpr (!null_preserving_pipeline<Pipeline>)
+            {
+                std::size_t const remaining = inputs.size() - wordIndex * detail::column_word_bits;
+                pending = remaining < detail::column_word_bits
+                            ? (std::uint64_t{1u} << remaining) - 1u
+                            : ~std::uint64_t{};
+            }
+
+            std::uint64_t result{};
+            while (0u != pending)
+            {
+                auto const bit = static_cast<std::size_t>(std::countr_zero(pending));
+                pending &= pending - 1u;
+
+                std::size_t const index = wordIndex * detail::column_word_bits + bit;
+                auto opt = steps.apply(inputs[index]);
+                if (detail::has_value(opt))
+                {
+                    outValues[index] = gimo::value(std::move(opt));
+                    result |= std::uint64_t{1u} << bit;
+                }
+            }
+
+            outValidity[wordIndex] = result;
+            engaged += static_cast<std::size_t>(std::popcount(result));
+        }
+
+        return engaged;
+    }
+}
+
+#endif
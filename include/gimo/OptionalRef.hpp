@@ -0,0 +1,182 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_OPTIONAL_REF_HPP
+#define GIMO_OPTIONAL_REF_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+
+#include <concepts>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    // Refers to an object, which is owned elsewhere, or to nothing.
+    // This is the result of transforms, whose actions return lvalue-references, so that the referred object is not copied.
+    template <typename T>
+        requires std::is_object_v<T>
+    class optional_ref
+    {
+    public:
+        using value_type = T;
+
+        [[nodiscard]]
+        constexpr optional_ref() noexcept = default;
+
+        [[nodiscard]]
+        explicit(false) constexpr optional_ref([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+        }
+
+        [[nodiscard]]
+        explicit(false) constexpr optional_ref(T& ref) noexcept
+            : m_Ptr{std::addressof(ref)}
+        {
+        }
+
+        // Prevents binding temporaries, when `T` is const.
+        optional_ref(std::remove_const_t<T>&&) = delete;
+
+        template <typename U>
+            requires(!std::same_as<U, T>) && std::convertible_to<U*, T*>
+        [[nodiscard]]
+        explicit(false) constexpr optional_ref(optional_ref<U> const other) noexcept
+            : m_Ptr{other.has_value() ? std::addressof(*other) : nullptr}
+        {
+        }
+
+        constexpr optional_ref& operator=([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            reset();
+
+            return *this;
+        }
+
+        [[nodiscard]]
+        constexpr bool has_value() const noexcept
+        {
+            return m_Ptr != nullptr;
+        }
+
+        [[nodiscard]]
+        explicit constexpr operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        constexpr void reset() noexcept
+        {
+            m_Ptr = nullptr;
+        }
+
+        [[nodiscard]]
+        constexpr T& operator*() const noexcept
+        {
+            GIMO_ASSERT(has_value(), "optional_ref must refer to an object.");
+
+            return *m_Ptr;
+        }
+
+        [[nodiscard]]
+        constexpr T* operator->() const noexcept
+        {
+            GIMO_ASSERT(has_value(), "optional_ref must refer to an object.");
+
+            return m_Ptr;
+        }
+
+        template <typename U>
+            requires std::convertible_to<U&&, std::remove_cv_t<T>>
+        [[nodiscard]]
+        constexpr std::remove_cv_t<T> value_or(U&& alternative) const
+        {
+            return has_value()
+                     ? *m_Ptr
+                     : static_cast<std::remove_cv_t<T>>(std::forward<U>(alternative));
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(optional_ref const opt, [[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            return !opt.has_value();
+        }
+
+        // Compares the identity of the referred objects, not their values.
+        [[nodiscard]]
+        friend constexpr bool operator==(optional_ref const lhs, optional_ref const rhs) noexcept
+        {
+            return lhs.m_Ptr == rhs.m_Ptr;
+        }
+
+    private:
+        T* m_Ptr{};
+    };
+}
+
+namespace gimo::detail
+{
+    // Rebinds lvalue-references to a non-owning nullable and everything else to `std::optional`.
+    // If the standard library supports `std::optional<T&>`, that is used instead of `optional_ref`.
+    template <typename V>
+    struct rebind_optional
+    {
+        using type = std::optional<std::remove_reference_t<V>>;
+    };
+
+    template <typename V>
+    struct rebind_optional<V&>
+    {
+#if defined(__cpp_lib_optional) && 202506L <= __cpp_lib_optional
+        using type = std::optional<V&>;
+#else
+        using type = optional_ref<V>;
+#endif
+    };
+
+    template <typename V>
+    using rebind_optional_t = typename rebind_optional<V>::type;
+
+    // Determines, whether the nullable is one of those, which `rebind_optional_t` yields.
+    template <typename T>
+    struct is_rebound_optional
+        : public std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_rebound_optional<std::optional<T>>
+        : public std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_rebound_optional<optional_ref<T>>
+        : public std::true_type
+    {
+    };
+}
+
+template <typename T>
+struct gimo::traits<gimo::optional_ref<T>>
+{
+    static constexpr auto null{std::nullopt};
+
+    [[nodiscard]]
+    static constexpr bool has_value(optional_ref<T> const opt) noexcept
+    {
+        return opt.has_value();
+    }
+
+    template <typename V>
+    using rebind_value = detail::rebind_optional_t<V>;
+};
+
+#endif
@@ -0,0 +1,390 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_PARALLEL_HPP
+#define GIMO_PARALLEL_HPP
+
+#pragma once
+
+#include "gimo/Batch.hpp"
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+
+#if defined(GIMO_CONFIG_EXECUTION_POLICIES) && defined(__cpp_lib_execution)
+    #include <execution>
+    #define GIMO_DETAIL_HAS_EXECUTION_POLICIES 1
+#endif
+
+namespace gimo
+{
+    template <typename Executor>
+    concept bulk_executor = requires(Executor& executor, void (*function)(std::size_t)) {
+        executor.bulk(std::size_t{}, function);
+    };
+
+    // Executes bulk jobs on a fixed set of worker threads; the calling thread participates as well.
+    // Each participant starts with an equally sized range of indices and steals half of another participant's
+    // remaining range, when it runs out of work.
+    class thread_pool
+    {
+    public:
+        [[nodiscard]]
+        static std::size_t default_concurrency() noexcept
+        {
+            return std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        [[nodiscard]]
+        explicit thread_pool(std::size_t const concurrency = default_concurrency())
+            : m_Ranges{std::make_unique<index_range[]>(std::max(concurrency, std::size_t{1u}))}
+        {
+            std::size_t const workerCount = std::max(concurrency, std::size_t{1u}) - 1u;
+            try
+            {
+                m_Workers.reserve(workerCount);
+                for (std::size_t i = 0u; i < workerCount; ++i)
+                {
+                    m_Workers.emplace_back([this, i] { work(i + 1u); });
+                }
+            }
+            catch (...)
+            {
+                // The already started workers must be joined, before they are destroyed.
+                stop();
+                throw;
+            }
+        }
+
+        thread_pool(thread_pool const&) = delete;
+        thread_pool& operator=(thread_pool const&) = delete;
+        thread_pool(thread_pool&&) = delete;
+        thread_pool& operator=(thread_pool&&) = delete;
+
+        ~thread_pool()
+        {
+            stop();
+        }
+
+        [[nodiscard]]
+        std::size_t concurrency() const noexcept
+        {
+            return m_Workers.size() + 1u;
+        }
+
+        // Invokes `function` exactly once for each index in [0, count) and blocks until all invocations are done.
+        // The first exception thrown by any invocation is rethrown, after all other invocations have finished.
+        // Must not be called from within a bulk job of the same pool.
+        template <std::invocable<std::size_t> Function>
+        void bulk(std::size_t const count, Function&& function)
+        {
+            if (0u == count)
+            {
+                return;
+            }
+
+            std::scoped_lock const bulkLock{m_BulkMutex};
+
+            std::size_t const participants = concurrency();
+            for (std::size_t i = 0u; i < participants; ++i)
+            {
+                std::scoped_lock const lock{m_Ranges[i].mutex};
+                m_Ranges[i].begin = count * i / participants;
+                m_Ranges[i].end = count * (i + 1u) / participants;
+            }
+
+            job const current{
+                .invoke = [](void* const context, std::size_t const index) {
+                    std::invoke(*static_cast<std::remove_reference_t<Function>*>(context), index);
+                },
+                .context = std::addressof(function)};
+            {
+                std::scoped_lock const lock{m_Mutex};
+                m_Job = current;
+                m_Active = m_Workers.size();
+                ++m_Generation;
+            }
+            m_WakeUp.notify_all();
+
+            run(0u, current);
+
+            std::exception_ptr exception{};
+            {
+                std::unique_lock lock{m_Mutex};
+                m_Done.wait(lock, [&] { return 0u == m_Active; });
+                exception = std::exchange(m_Exception, nullptr);
+            }
+
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+
+    private:
+        struct job
+        {
+            void (*invoke)(void*, std::size_t){};
+            void* context{};
+        };
+
+        struct alignas(64) index_range
+        {
+            std::mutex mutex{};
+            std::size_t begin{};
+            std::size_t end{};
+        };
+
+        std::unique_ptr<index_range[]> m_Ranges;
+        std::vector<std::thread> m_Workers{};
+
+        std::mutex m_BulkMutex{};
+        std::mutex m_Mutex{};
+        std::condition_variable m_WakeUp{};
+        std::condition_variable m_Done{};
+        job m_Job{};
+        std::size_t m_Generation{};
+        std::size_t m_Active{};
+        bool m_Stopping{false};
+        std::exception_ptr m_Exception{};
+
+        void stop() noexcept
+        {
+            {
+                std::scoped_lock const lock{m_Mutex};
+                m_Stopping = true;
+            }
+            m_WakeUp.notify_all();
+
+            for (std::thread& worker : m_Workers)
+            {
+                worker.join();
+            }
+        }
+
+        void work(std::size_t const self)
+        {
+            std::size_t generation{};
+            for (;;)
+            {
+                job current{};
+                {
+                    std::unique_lock lock{m_Mutex};
+                    m_WakeUp.wait(lock, [&] { return m_Stopping || generation != m_Generation; });
+                    if (m_Stopping)
+                    {
+                        return;
+                    }
+
+                    generation = m_Generation;
+                    current = m_Job;
+                }
+
+                run(self, current);
+
+                std::scoped_lock const lock{m_Mutex};
+                if (0u == --m_Active)
+                {
+                    m_Done.notify_all();
+                }
+            }
+        }
+
+        void run(std::size_t const self, job const& current)
+        {
+            std::size_t index{};
+            while (take(self, index) || steal(self, index))
+            {
+                try
+                {
+                    current.invoke(current.context, index);
+                }
+                catch (...)
+                {
+                    std::scoped_lock const lock{m_Mutex};
+                    if (!m_Exception)
+                    {
+                        m_Exception = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]]
+        bool take(std::size_t const self, std::size_t& index)
+        {
+            index_range& range = m_Ranges[self];
+            std::scoped_lock const lock{range.mutex};
+            if (range.begin == range.end)
+            {
+                return false;
+            }
+
+            index = range.begin++;
+
+            return true;
+        }
+
+        [[nodiscard]]
+        bool steal(std::size_t const self, std::size_t& index)
+        {
+            std::size_t const participants = concurrency();
+            for (std::size_t offset = 1u; offset < participants; ++offset)
+            {
+                std::size_t begin{};
+                std::size_t end{};
+                {
+                    index_range& victim = m_Ranges[(self + offset) % participants];
+                    std::scoped_lock const lock{victim.mutex};
+                    std::size_t const remaining = victim.end - victim.begin;
+                    if (0u == remaining)
+                    {
+                        continue;
+                    }
+
+                    end = victim.end;
+                    victim.end -= (remaining + 1u) / 2u;
+                    begin = victim.end;
+                }
+
+                index = begin;
+                index_range& range = m_Ranges[self];
+                std::scoped_lock const lock{range.mutex};
+                range.begin = begin + 1u;
+                range.end = end;
+
+                return true;
+            }
+
+            return false;
+        }
+    };
+
+    namespace detail
+    {
+        // Chunks are sized, so that a chunk of inputs and outputs fits into a typical L1 data cache.
+        inline constexpr std::size_t parallel_chunk_bytes{32u * 1024u};
+
+        template <typename In, typename Out>
+        inline constexpr std::size_t parallel_chunk_size = std::max(
+            std::size_t{1u},
+            parallel_chunk_bytes / (sizeof(In) + sizeof(Out)));
+
+#ifdef GIMO_DETAIL_HAS_EXECUTION_POLICIES
+        template <typename Policy>
+        class policy_executor
+        {
+        public:
+            [[nodiscard]]
+            explicit constexpr policy_executor(Policy const& policy) noexcept
+                : m_Policy{std::addressof(policy)}
+            {
+            }
+
+            template <std::invocable<std::size_t> Function>
+            void bulk(std::size_t const count, Function&& function) const
+            {
+                std::vector<std::size_t> indices(count);
+                std::iota(indices.begin(), indices.end(), std::size_t{});
+                std::for_each(*m_Policy, indices.cbegin(), indices.cend(), std::ref(function));
+            }
+
+        private:
+            Policy const* m_Policy;
+        };
+#endif
+
+        template <typename Executor, typename Function>
+        void bulk(Executor& executor, std::size_t const count, Function&& function)
+        {
+#ifdef GIMO_DETAIL_HAS_EXECUTION_POLICIES
+            if constexpr (std::is_execution_policy_v<std::remove_cvref_t<Executor>>)
+            {
+                policy_executor{executor}.bulk(count, std::forward<Function>(function));
+            }
+            else
+#endif
+            {
+                executor.bulk(count, std::forward<Function>(function));
+            }
+        }
+
+        template <typename Executor>
+        concept parallel_executor = bulk_executor<Executor>
+#ifdef GIMO_DETAIL_HAS_EXECUTION_POLICIES
+                                 || std::is_execution_policy_v<std::remove_cvref_t<Executor>>
+#endif
+            ;
+
+        template <typename Range>
+        concept parallel_range = std::ranges::contiguous_range<Range>
+                              && std::ranges::sized_range<Range>;
+    }
+
+    // Applies the pipeline on the inputs in parallel and writes the results at the same positions of the outputs.
+    // The pipeline is shared among all threads and is thus only accessed via const&.
+    // The executor must either be a `bulk_executor` (e.g. `gimo::thread_pool`) or, if enabled, a standard execution-policy.
+    template <detail::parallel_range Inputs, detail::parallel_range Outputs, applicable_pipeline Pipeline, typename Executor>
+        requires batch_applicable<
+                     Pipeline const,
+                     std::ranges::range_value_t<Inputs> const&,
+                     std::ranges::range_value_t<Outputs>>
+              && detail::parallel_executor<Executor>
+    std::size_t parallel_apply(Inputs&& inputs, Outputs&& outputs, Pipeline const& steps, Executor&& executor)
+    {
+        using In = std::ranges::range_value_t<Inputs>;
+        using Out = std::ranges::range_value_t<Outputs>;
+
+        std::span<In const> const in{std::ranges::data(inputs), std::ranges::size(inputs)};
+        std::span<Out> const out{std::ranges::data(outputs), std::ranges::size(outputs)};
+        GIMO_ASSERT(in.size() <= out.size(), "Output must be at least as large as the input.", in, out);
+
+        constexpr std::size_t chunkSize = detail::parallel_chunk_size<In, Out>;
+        std::size_t const chunkCount = (in.size() + chunkSize - 1u) / chunkSize;
+        std::vector<std::size_t> engaged(chunkCount);
+        detail::bulk(
+            executor,
+            chunkCount,
+            [&](std::size_t const chunk) {
+                std::size_t const offset = chunk * chunkSize;
+                std::size_t const length = std::min(chunkSize, in.size() - offset);
+                engaged[chunk] = gimo::apply_batch(in.subspan(offset, length), out.subspan(offset, length), steps);
+            });
+
+        return std::reduce(engaged.cbegin(), engaged.cend());
+    }
+
+    template <detail::parallel_range Inputs, applicable_pipeline Pipeline, typename Executor>
+        requires detail::parallel_executor<Executor>
+    [[nodiscard]]
+    auto parallel_apply(Inputs&& inputs, Pipeline const& steps, Executor&& executor)
+    {
+        using Result = std::remove_cvref_t<decltype(steps.apply(std::declval<std::ranges::range_value_t<Inputs> const&>()))>;
+
+        std::vector<Result> results(std::ranges::size(inputs));
+        gimo::parallel_apply(inputs, results, steps, executor);
+
+        return results;
+    }
+}
+
+#endif
@@ -9,12 +9,344 @@
 #pragma once
 
 #include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Engaged.hpp"
 
+#include <array>
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+namespace gimo
+{
+    // Determines, which branch of the null-test of a pipeline step is expected to be taken.
+    enum class expectation
+    {
+        none,
+        value,
+        null
+    };
+}
+
+namespace gimo::detail
+{
+    template <typename First, typename Second>
+    struct step_fusion
+    {
+    };
+
+    template <typename First, typename Second>
+    concept fusable_steps = requires(First&& first, Second&& second) {
+        step_fusion<std::remove_cvref_t<First>, std::remove_cvref_t<Second>>::fuse(
+            std::forward<First>(first),
+            std::forward<Second>(second));
+    };
+
+    template <typename Step>
+    concept null_preserving_step = requires {
+        requires std::remove_cvref_t<Step>::traits_type::is_null_preserving;
+    };
+
+    template <expectation expected>
+    struct uniform_expectations
+    {
+        [[nodiscard]]
+        static consteval expectation at([[maybe_unused]] std::size_t const index) noexcept
+        {
+            return expected;
+        }
+    };
+
+    template <expectation... expected>
+    struct step_expectations
+    {
+        [[nodiscard]]
+        static consteval expectation at(std::size_t const index) noexcept
+        {
+            constexpr expectation table[]{expected...};
+
+            return table[index];
+        }
+    };
+
+    using no_expectations = uniform_expectations<expectation::none>;
+
+    // The null path of all `expectation::value` pipelines with the same result type, as long as that result
+    // is always null.
+    template <nullable Nullable>
+    [[nodiscard]]
+    GIMO_DETAIL_COLD constexpr Nullable construct_empty_cold()
+    {
+        return detail::construct_empty<Nullable>();
+    }
+
+    // The path, which has been taken by a step of a pipeline. Errors are counted as null.
+    enum class step_path
+    {
+        value,
+        null
+    };
+
+    // The default probe of pipelines, which records nothing and thus compiles away entirely.
+    // Probes are notified, when a step is entered, and may observe the step until the returned object is destroyed.
+    struct no_probe
+    {
+        static constexpr bool enabled{false};
+
+        struct sample
+        {
+        };
+
+        template <std::size_t index>
+        [[nodiscard]]
+        GIMO_DETAIL_INTRINSIC constexpr sample enter([[maybe_unused]] step_path const path) const noexcept
+        {
+            return {};
+        }
+    };
+
+    template <std::size_t index, typename Expectations, typename Probe, typename... StepRefs>
+    class pipeline_tail;
+
+    template <std::size_t index, typename Expectations, typename Probe>
+    class pipeline_tail<index, Expectations, Probe>
+    {
+    public:
+        struct node
+        {
+        };
+    };
+
+    // Represents the remaining steps of a pipeline, starting at `index`, as a single argument.
+    // As each step is thus invoked with at most one trailing argument, the instantiations do not grow with
+    // the number of remaining steps. As the tail only names the remaining steps (and not all steps of the pipeline),
+    // the names of its instantiations are not longer than those of expanded trailing arguments would be.
+    // Enabled probes require the null-test to happen here, as the steps would otherwise perform it internally.
+    template <std::size_t index, typename Expectations, typename Probe, typename StepRef, typename... Rest>
+    class pipeline_tail<index, Expectations, Probe, StepRef, Rest...>
+    {
+        using next_tail = pipeline_tail<index + 1u, Expectations, Probe, Rest...>;
+
+    public:
+        static constexpr bool is_last{0u == sizeof...(Rest)};
+        static constexpr bool is_null_preserving{(null_preserving_step<StepRef> && ... && null_preserving_step<Rest>)};
+
+        // Refers to the current step and owns the node of the following ones.
+        // Being nested, the name of a node does not repeat the remaining steps.
+        struct node
+        {
+            StepRef step;
+            [[no_unique_address]] typename next_tail::node rest;
+
+            [[nodiscard]]
+            explicit constexpr node(StepRef current, Rest... others) noexcept
+                : step{GIMO_DETAIL_FORWARD(current)},
+                  rest{GIMO_DETAIL_FORWARD(others)...}
+            {
+            }
+        };
+
+        static constexpr expectation expected{Expectations::at(index)};
+
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN explicit constexpr pipeline_tail(node& current, Probe const probe) noexcept
+            : m_Node{std::addressof(current)},
+              m_Probe{probe}
+        {
+        }
+
+        template <typename Nullable>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Nullable&& opt) &&
+        {
+            if constexpr (expectation::value == expected)
+            {
+                if (detail::has_value(opt)) [[likely]]
+                {
+                    return std::move(*this).on_value(GIMO_DETAIL_FORWARD(opt));
+                }
+
+                if constexpr (fallible<Nullable>)
+                {
+                    return std::move(*this).on_error_outlined(GIMO_DETAIL_FORWARD(opt));
+                }
+                else
+                {
+                    return std::move(*this).template on_null_cold<Nullable>();
+                }
+            }
+            else if constexpr (expectation::null == expected)
+            {
+                if (detail::has_value(opt)) [[unlikely]]
+                {
+                    return std::move(*this).on_value(GIMO_DETAIL_FORWARD(opt));
+                }
+
+                if constexpr (fallible<Nullable>)
+                {
+                    return std::move(*this).on_error(GIMO_DETAIL_FORWARD(opt));
+                }
+                else
+                {
+                    return std::move(*this).template on_null<Nullable>();
+                }
+            }
+            else if constexpr (Probe::enabled)
+            {
+                if (detail::has_value(opt))
+                {
+                    return std::move(*this).on_value(GIMO_DETAIL_FORWARD(opt));
+                }
+
+                if constexpr (fallible<Nullable>)
+                {
+                    return std::move(*this).on_error(GIMO_DETAIL_FORWARD(opt));
+                }
+                else
+                {
+                    return std::move(*this).template on_null<Nullable>();
+                }
+            }
+            else if constexpr (is_last)
+            {
+                return detail::invoke(step(), GIMO_DETAIL_FORWARD(opt));
+            }
+            else
+            {
+                return detail::invoke(step(), GIMO_DETAIL_FORWARD(opt), next());
+            }
+        }
+
+        template <typename Nullable>
+        GIMO_DETAIL_FLATTEN constexpr auto on_value(Nullable&& opt) &&
+        {
+            [[maybe_unused]] auto const sample = m_Probe.template enter<index>(step_path::value);
+
+            if constexpr (is_last)
+            {
+                return step().on_value(GIMO_DETAIL_FORWARD(opt));
+            }
+            else
+            {
+                return step().on_value(GIMO_DETAIL_FORWARD(opt), next());
+            }
+        }
+
+        template <typename Nullable>
+        GIMO_DETAIL_FLATTEN constexpr auto on_error(Nullable&& opt) &&
+        {
+            [[maybe_unused]] auto const sample = m_Probe.template enter<index>(step_path::null);
+
+            if constexpr (is_last)
+            {
+                return step().on_error(GIMO_DETAIL_FORWARD(opt));
+            }
+            else
+            {
+                return step().on_error(GIMO_DETAIL_FORWARD(opt), next());
+            }
+        }
+
+        template <typename Nullable>
+        GIMO_DETAIL_FLATTEN constexpr auto on_null() &&
+        {
+            [[maybe_unused]] auto const sample = m_Probe.template enter<index>(step_path::null);
+
+            if constexpr (is_last)
+            {
+                return step().template on_null<Nullable>();
+            }
+            else
+            {
+                return step().template on_null<Nullable>(next());
+            }
+        }
+
+    private:
+        node* m_Node;
+        [[no_unique_address]] Probe m_Probe;
+
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr decltype(auto) step() noexcept
+        {
+            return GIMO_DETAIL_FORWARD(m_Node->step);
+        }
+
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr auto next() noexcept
+        {
+            return next_tail{m_Node->rest, m_Probe};
+        }
+
+        // If the result is known to be null, the shared cold function is used.
+        // Otherwise, the remaining steps (e.g. an `or_else`) must still be executed, which is outlined per pipeline.
+        template <typename Nullable>
+        [[nodiscard]]
+        constexpr auto on_null_cold() &&
+        {
+            if constexpr (is_null_preserving)
+            {
+                using Result = decltype(std::move(*this).template on_null<Nullable>());
+
+                return detail::construct_empty_cold<Result>();
+            }
+            else
+            {
+                return std::move(*this).template on_null_outlined<Nullable>();
+            }
+        }
+
+        template <typename Nullable>
+        [[nodiscard]]
+        GIMO_DETAIL_COLD constexpr auto on_null_outlined() &&
+        {
+            return std::move(*this).template on_null<Nullable>();
+        }
+
+        // Errors can not share a cold function, as they must be propagated.
+        template <typename Nullable>
+        [[nodiscard]]
+        GIMO_DETAIL_COLD constexpr auto on_error_outlined(Nullable&& opt) &&
+        {
+            return std::move(*this).on_error(GIMO_DETAIL_FORWARD(opt));
+        }
+    };
+
+    template <typename Expectations, typename Steps, typename Nullable, typename Probe, std::size_t... indices>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto apply_steps(
+        Steps&& steps,
+        Nullable&& opt,
+        Probe const probe,
+        [[maybe_unused]] std::index_sequence<indices...> const sequence)
+    {
+        using Tail = pipeline_tail<0u, Expectations, Probe, decltype(std::get<indices>(GIMO_DETAIL_FORWARD(steps)))...>;
+        typename Tail::node nodes{std::get<indices>(GIMO_DETAIL_FORWARD(steps))...};
+
+        if constexpr (known_engaged<Nullable>)
+        {
+            return Tail{nodes, probe}.on_value(GIMO_DETAIL_FORWARD(opt).get());
+        }
+        else
+        {
+            return Tail{nodes, probe}(GIMO_DETAIL_FORWARD(opt));
+        }
+    }
+
+    template <typename Expectations, typename Steps, typename Nullable, typename Probe = no_probe>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto apply_steps(Steps&& steps, Nullable&& opt, Probe const probe = Probe{})
+    {
+        return detail::apply_steps<Expectations>(
+            GIMO_DETAIL_FORWARD(steps),
+            GIMO_DETAIL_FORWARD(opt),
+            probe,
+            std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<Steps>>>{});
+    }
+}
+
 namespace gimo
 {
     template <typename... Steps>
@@ -30,28 +362,52 @@ namespace gimo
         {
         }
 
-        template <nullable Nullable>
-        constexpr auto apply(Nullable&& opt) &
+        template <detail::pipeline_input Nullable>
+        GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) &
         {
-            return apply(*this, std::forward<Nullable>(opt));
+            return apply(*this, GIMO_DETAIL_FORWARD(opt));
         }
 
-        template <nullable Nullable>
-        constexpr auto apply(Nullable&& opt) const&
+        template <detail::pipeline_input Nullable>
+        GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) const&
         {
-            return apply(*this, std::forward<Nullable>(opt));
+            return apply(*this, GIMO_DETAIL_FORWARD(opt));
         }
 
-        template <nullable Nullable>
-        constexpr auto apply(Nullable&& opt) &&
+        template <detail::pipeline_input Nullable>
+        GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) &&
         {
-            return apply(std::move(*this), std::forward<Nullable>(opt));
+            return apply(std::move(*this), GIMO_DETAIL_FORWARD(opt));
         }
 
-        template <nullable Nullable>
-        constexpr auto apply(Nullable&& opt) const&&
+        template <detail::pipeline_input Nullable>
+        GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) const&&
         {
-            return apply(std::move(*this), std::forward<Nullable>(opt));
+            return apply(std::move(*this), GIMO_DETAIL_FORWARD(opt));
+        }
+
+        [[nodiscard]]
+        constexpr std::tuple<Steps...>& steps() & noexcept
+        {
+            return m_Steps;
+        }
+
+        [[nodiscard]]
+        constexpr std::tuple<Steps...> const& steps() const& noexcept
+        {
+            return m_Steps;
+        }
+
+        [[nodiscard]]
+        constexpr std::tuple<Steps...>&& steps() && noexcept
+        {
+            return std::move(m_Steps);
+        }
+
+        [[nodiscard]]
+        constexpr std::tuple<Steps...> const&& steps() const&& noexcept
+        {
+            return std::move(m_Steps);
         }
 
         template <typename... SuffixSteps>
@@ -85,26 +441,83 @@ namespace gimo
 
         template <typename Self, typename Nullable>
         [[nodiscard]]
-        static constexpr auto apply(Self&& self, Nullable&& opt)
+        GIMO_DETAIL_FLATTEN static constexpr auto apply(Self&& self, Nullable&& opt)
         {
-            return std::apply(
-                [&]<typename First, typename... Others>(First&& first, Others&&... steps) {
-                    return std::invoke(
-                        std::forward<First>(first),
-                        std::forward<Nullable>(opt),
-                        std::forward<Others>(steps)...);
-                },
-                std::forward<Self>(self).m_Steps);
+            return detail::apply_steps<detail::no_expectations>(
+                GIMO_DETAIL_FORWARD(self).m_Steps,
+                GIMO_DETAIL_FORWARD(opt));
         }
 
         template <typename Self, typename... SuffixSteps>
         [[nodiscard]]
         static constexpr auto append(Self&& self, std::tuple<SuffixSteps...>&& suffixSteps)
         {
-            using Appended = Pipeline<Steps..., SuffixSteps...>;
+            if constexpr (is_fusable<Self, SuffixSteps...>())
+            {
+                return fuse(
+                    std::forward<Self>(self),
+                    std::move(suffixSteps),
+                    std::make_index_sequence<sizeof...(Steps) - 1u>{},
+                    std::make_index_sequence<sizeof...(SuffixSteps) - 1u>{});
+            }
+            else
+            {
+                using Appended = Pipeline<Steps..., SuffixSteps...>;
+
+                return Appended{
+                    std::tuple_cat(std::forward<Self>(self).m_Steps, std::move(suffixSteps))};
+            }
+        }
+
+        template <typename Self, typename... SuffixSteps>
+        [[nodiscard]]
+        static consteval bool is_fusable()
+        {
+            if constexpr (0u < sizeof...(Steps) && 0u < sizeof...(SuffixSteps))
+            {
+                using Last = std::tuple_element_t<sizeof...(Steps) - 1u, std::tuple<Steps...>>;
+                using First = std::tuple_element_t<0u, std::tuple<SuffixSteps...>>;
+
+                return detail::fusable_steps<detail::const_ref_like_t<Self, Last>, First&&>;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        // Adjacent steps, which can be merged into a single one, are fused at the boundary of both pipelines.
+        // As each pipeline is already fused internally, this is the only place where new candidates can arise.
+        template <typename Self, typename... SuffixSteps, std::size_t... prefixIndices, std::size_t... suffixIndices>
+        [[nodiscard]]
+        static constexpr auto fuse(
+            Self&& self,
+            std::tuple<SuffixSteps...>&& suffixSteps,
+            [[maybe_unused]] std::index_sequence<prefixIndices...> const prefixSequence,
+            [[maybe_unused]] std::index_sequence<suffixIndices...> const suffixSequence)
+        {
+            using Prefix = std::tuple<Steps...>;
+            using Suffix = std::tuple<SuffixSteps...>;
+            using Fusion = detail::step_fusion<
+                std::tuple_element_t<sizeof...(Steps) - 1u, Prefix>,
+                std::tuple_element_t<0u, Suffix>>;
+
+            auto fused = Fusion::fuse(
+                std::get<sizeof...(Steps) - 1u>(std::forward<Self>(self).m_Steps),
+                std::get<0u>(std::move(suffixSteps)));
+            using Appended = Pipeline<
+                std::tuple_element_t<prefixIndices, Prefix>...,
+                decltype(fused),
+                std::tuple_element_t<suffixIndices + 1u, Suffix>...>;
 
             return Appended{
-                std::tuple_cat(std::forward<Self>(self).m_Steps, std::move(suffixSteps))};
+                std::tuple<
+                    std::tuple_element_t<prefixIndices, Prefix>...,
+                    decltype(fused),
+                    std::tuple_element_t<suffixIndices + 1u, Suffix>...>{
+                    std::get<prefixIndices>(std::forward<Self>(self).m_Steps)...,
+                    std::move(fused),
+                    std::get<suffixIndices + 1u>(std::move(suffixSteps))...}};
         }
     };
 
@@ -126,11 +539,268 @@ namespace gimo
     template <typename T>
     concept pipeline = detail::is_pipeline<std::remove_cvref_t<T>>::value;
 
-    template <nullable Nullable, pipeline Pipeline>
+    namespace detail
+    {
+        template <typename T>
+        struct is_applicable_pipeline
+            : public is_pipeline<T>
+        {
+        };
+    }
+
+    // Determines, whether `T` can be applied like a pipeline. Unlike `pipeline`, this also includes those, which
+    // can not be composed any further (e.g. the results of `gimo::expect_value`).
+    template <typename T>
+    concept applicable_pipeline = detail::is_applicable_pipeline<std::remove_cvref_t<T>>::value;
+
+    namespace detail
+    {
+        template <typename T>
+        struct is_null_preserving
+            : public std::false_type
+        {
+        };
+
+        template <typename... Steps>
+        struct is_null_preserving<Pipeline<Steps...>>
+            : public std::bool_constant<(null_preserving_step<Steps> && ...)>
+        {
+        };
+    }
+
+    // Determines, whether the pipeline always yields null, when applied on a null input.
+    // This enables batch algorithms to skip null inputs entirely.
+    template <typename T>
+    concept null_preserving_pipeline = applicable_pipeline<T>
+                                    && detail::is_null_preserving<std::remove_cvref_t<T>>::value;
+
+    namespace detail
+    {
+        template <typename Expectations, typename Pipeline>
+        class expecting_pipeline
+        {
+        public:
+            [[nodiscard]]
+            explicit constexpr expecting_pipeline(Pipeline pipeline)
+                : m_Pipeline{std::move(pipeline)}
+            {
+            }
+
+            template <pipeline_input Nullable>
+            GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) &
+            {
+                return apply(*this, GIMO_DETAIL_FORWARD(opt));
+            }
+
+            template <pipeline_input Nullable>
+            GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) const&
+            {
+                return apply(*this, GIMO_DETAIL_FORWARD(opt));
+            }
+
+            template <pipeline_input Nullable>
+            GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) &&
+            {
+                return apply(std::move(*this), GIMO_DETAIL_FORWARD(opt));
+            }
+
+            template <pipeline_input Nullable>
+            GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt) const&&
+            {
+                return apply(std::move(*this), GIMO_DETAIL_FORWARD(opt));
+            }
+
+            [[nodiscard]]
+            constexpr Pipeline const& pipeline() const& noexcept
+            {
+                return m_Pipeline;
+            }
+
+            [[nodiscard]]
+            constexpr Pipeline&& pipeline() && noexcept
+            {
+                return std::move(m_Pipeline);
+            }
+
+        private:
+            Pipeline m_Pipeline;
+
+            template <typename Self, typename Nullable>
+            [[nodiscard]]
+            GIMO_DETAIL_FLATTEN static constexpr auto apply(Self&& self, Nullable&& opt)
+            {
+                return detail::apply_steps<Expectations>(
+                    GIMO_DETAIL_FORWARD(self).m_Pipeline.steps(),
+                    GIMO_DETAIL_FORWARD(opt));
+            }
+        };
+
+        template <typename Expectations, typename Pipeline>
+        struct is_applicable_pipeline<expecting_pipeline<Expectations, Pipeline>>
+            : public std::true_type
+        {
+        };
+
+        template <typename Expectations, typename Pipeline>
+        struct is_null_preserving<expecting_pipeline<Expectations, Pipeline>>
+            : public is_null_preserving<Pipeline>
+        {
+        };
+    }
+
+    // Hints, that the pipeline is mostly applied on engaged nullables.
+    // The value branches are marked `[[likely]]` and the null path is moved into a cold function. When the remaining
+    // steps are null-preserving, that function only constructs the empty result and is thus shared by all pipelines
+    // with the same result type.
+    // The returned object can be applied like a pipeline, but can not be composed any further.
+    template <typename... Steps>
+    [[nodiscard]]
+    constexpr auto expect_value(Pipeline<Steps...> steps)
+    {
+        return detail::expecting_pipeline<detail::uniform_expectations<expectation::value>, Pipeline<Steps...>>{std::move(steps)};
+    }
+
+    // Hints, that the pipeline is mostly applied on null nullables.
+    // The value branches are marked `[[unlikely]]`.
+    // The returned object can be applied like a pipeline, but can not be composed any further.
+    template <typename... Steps>
+    [[nodiscard]]
+    constexpr auto expect_null(Pipeline<Steps...> steps)
+    {
+        return detail::expecting_pipeline<detail::uniform_expectations<expectation::null>, Pipeline<Steps...>>{std::move(steps)};
+    }
+
+    // Hints the branch of each step individually, e.g. derived from the counters of `gimo::instrument`.
+    // Steps with `expectation::value` and `expectation::null` are treated like those of `expect_value` and
+    // `expect_null`, respectively. The expectation of a step refers to its input, thus the first one refers to the
+    // nullable, the pipeline is applied on.
+    // As adjacent transforms are fused, the hints refer to the steps of the composed pipeline.
+    // The returned object can be applied like a pipeline, but can not be composed any further.
+    template <expectation... expected, typename... Steps>
+        requires(sizeof...(expected) == sizeof...(Steps))
+    [[nodiscard]]
+    constexpr auto expect_steps(Pipeline<Steps...> steps)
+    {
+        return detail::expecting_pipeline<detail::step_expectations<expected...>, Pipeline<Steps...>>{std::move(steps)};
+    }
+
+    namespace detail
+    {
+        // Marks the indices of the concatenated steps, at which a piped pipeline begins.
+        template <std::size_t... sizes>
+        [[nodiscard]]
+        consteval auto pipe_boundaries() noexcept
+        {
+            std::array<bool, (0u + ... + sizes)> boundaries{};
+            std::size_t index{};
+            for (std::size_t const size : {sizes...})
+            {
+                if (index < boundaries.size())
+                {
+                    boundaries[index] = true;
+                }
+
+                index += size;
+            }
+
+            return boundaries;
+        }
+
+        // Determines the end of the run of steps, which are fused into `Fused`.
+        // Like `operator|`, steps are only fused at the boundaries of the piped pipelines.
+        template <typename Steps, auto boundaries, std::size_t index, typename Fused>
+        [[nodiscard]]
+        consteval std::size_t fusion_end() noexcept
+        {
+            if constexpr (index < boundaries.size())
+            {
+                using Next = std::tuple_element_t<index, Steps>;
+                if constexpr (boundaries[index] && fusable_steps<Fused&&, Next&&>)
+                {
+                    using Fusion = step_fusion<Fused, Next>;
+                    using Result = decltype(Fusion::fuse(std::declval<Fused>(), std::declval<Next>()));
+
+                    return detail::fusion_end<Steps, boundaries, index + 1u, Result>();
+                }
+            }
+
+            return index;
+        }
+
+        template <typename Steps, auto boundaries, std::size_t begin>
+        inline constexpr std::size_t fusion_end_v{
+            detail::fusion_end<Steps, boundaries, begin + 1u, std::tuple_element_t<begin, Steps>>()};
+
+        // Collects the first index of each step of the piped pipeline.
+        template <typename Steps, auto boundaries, std::size_t begin = 0u>
+        [[nodiscard]]
+        consteval auto fusion_begins() noexcept
+        {
+            if constexpr (begin < boundaries.size())
+            {
+                return []<std::size_t... others>([[maybe_unused]] std::index_sequence<others...> const sequence) {
+                    return std::index_sequence<begin, others...>{};
+                }(detail::fusion_begins<Steps, boundaries, fusion_end_v<Steps, boundaries, begin>>());
+            }
+            else
+            {
+                return std::index_sequence<>{};
+            }
+        }
+
+        // Fuses the steps `[begin, end)` from left to right, like chained `operator|` calls do.
+        template <std::size_t begin, std::size_t end, typename Steps>
+        [[nodiscard]]
+        constexpr auto fuse_steps(Steps& steps)
+        {
+            if constexpr (begin + 1u == end)
+            {
+                return std::get<begin>(std::move(steps));
+            }
+            else
+            {
+                using Fused = decltype(detail::fuse_steps<begin, end - 1u>(steps));
+                using Fusion = step_fusion<Fused, std::tuple_element_t<end - 1u, Steps>>;
+
+                return Fusion::fuse(
+                    detail::fuse_steps<begin, end - 1u>(steps),
+                    std::get<end - 1u>(std::move(steps)));
+            }
+        }
+
+        template <auto boundaries, typename Steps, std::size_t... begins>
+        [[nodiscard]]
+        constexpr auto pipe_steps(Steps& steps, [[maybe_unused]] std::index_sequence<begins...> const sequence)
+        {
+            using Piped = gimo::Pipeline<
+                decltype(detail::fuse_steps<begins, fusion_end_v<Steps, boundaries, begins>>(steps))...>;
+
+            return Piped{std::tuple{detail::fuse_steps<begins, fusion_end_v<Steps, boundaries, begins>>(steps)...}};
+        }
+    }
+
+    // Concatenates all steps of the given pipelines into a single pipeline at once.
+    // This avoids the intermediate pipelines of chained `operator|` calls. Adjacent steps of different pipelines are
+    // fused, like `operator|` does.
+    template <pipeline... Pipelines>
+        requires(0u < sizeof...(Pipelines))
+    [[nodiscard]]
+    constexpr auto pipe(Pipelines&&... pipelines)
+    {
+        using Steps = decltype(std::tuple_cat(std::forward<Pipelines>(pipelines).steps()...));
+        constexpr auto boundaries = detail::pipe_boundaries<
+            std::tuple_size_v<std::remove_cvref_t<decltype(pipelines.steps())>>...>();
+
+        auto steps = std::tuple_cat(std::forward<Pipelines>(pipelines).steps()...);
+
+        return detail::pipe_steps<boundaries>(steps, detail::fusion_begins<Steps, boundaries>());
+    }
+
+    template <detail::pipeline_input Nullable, applicable_pipeline Pipeline>
     [[nodiscard]]
-    constexpr auto apply(Nullable&& opt, Pipeline&& steps)
+    GIMO_DETAIL_FLATTEN constexpr auto apply(Nullable&& opt, Pipeline&& steps)
     {
-        return std::forward<Pipeline>(steps).apply(std::forward<Nullable>(opt));
+        return GIMO_DETAIL_FORWARD(steps).apply(GIMO_DETAIL_FORWARD(opt));
     }
 }
 
@@ -0,0 +1,88 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_PURE_HPP
+#define GIMO_PURE_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    namespace detail
+    {
+        template <unqualified Action>
+        class pure_wrapper
+        {
+        public:
+            template <typename... Args>
+                requires std::constructible_from<Action, Args&&...>
+            [[nodiscard]]
+            explicit constexpr pure_wrapper(Args&&... args) noexcept(std::is_nothrow_constructible_v<Action, Args&&...>)
+                : m_Action{std::forward<Args>(args)...}
+            {
+            }
+
+            template <typename... Args>
+            constexpr auto operator()(Args&&... args) & -> std::invoke_result_t<Action&, Args&&...>
+            {
+                return std::invoke(m_Action, std::forward<Args>(args)...);
+            }
+
+            template <typename... Args>
+            constexpr auto operator()(Args&&... args) const& -> std::invoke_result_t<Action const&, Args&&...>
+            {
+                return std::invoke(m_Action, std::forward<Args>(args)...);
+            }
+
+            template <typename... Args>
+            constexpr auto operator()(Args&&... args) && -> std::invoke_result_t<Action&&, Args&&...>
+            {
+                return std::invoke(std::move(m_Action), std::forward<Args>(args)...);
+            }
+
+            template <typename... Args>
+            constexpr auto operator()(Args&&... args) const&& -> std::invoke_result_t<Action const&&, Args&&...>
+            {
+                return std::invoke(std::move(m_Action), std::forward<Args>(args)...);
+            }
+
+        private:
+            [[no_unique_address]] Action m_Action;
+        };
+
+        template <typename T>
+        struct is_pure_action
+            : public std::false_type
+        {
+        };
+
+        template <typename Action>
+        struct is_pure_action<pure_wrapper<Action>>
+            : public std::true_type
+        {
+        };
+    }
+
+    // Marks an action as free of side effects and well-defined for every possible argument value.
+    // Batch algorithms may then invoke it unconditionally, even for null elements, and discard those results afterwards.
+    template <typename Action>
+    [[nodiscard]]
+    constexpr auto pure(Action&& action)
+    {
+        return detail::pure_wrapper<std::remove_cvref_t<Action>>{std::forward<Action>(action)};
+    }
+
+    template <typename Action>
+    concept pure_action = detail::is_pure_action<std::remove_cvref_t<Action>>::value;
+}
+
+#endif
@@ -0,0 +1,150 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_SENTINEL_OPTIONAL_HPP
+#define GIMO_SENTINEL_OPTIONAL_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/OptionalRef.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <concepts>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    // Reserves the `sentinel` value of `T` as null-state and is thus exactly as large as `T`.
+    template <unqualified T, T sentinel>
+    class sentinel_optional
+    {
+    public:
+        using value_type = T;
+
+        static constexpr T sentinel_value{sentinel};
+
+        [[nodiscard]]
+        constexpr sentinel_optional() noexcept = default;
+
+        [[nodiscard]]
+        explicit(false) constexpr sentinel_optional([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+        }
+
+        template <typename U = T>
+            requires std::constructible_from<T, U&&>
+                  && (!std::same_as<std::remove_cvref_t<U>, sentinel_optional>)
+                  && (!std::same_as<std::remove_cvref_t<U>, std::nullopt_t>)
+        [[nodiscard]]
+        explicit(!std::convertible_to<U&&, T>) constexpr sentinel_optional(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+            : m_Value(std::forward<U>(value))
+        {
+        }
+
+        constexpr sentinel_optional& operator=([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            reset();
+
+            return *this;
+        }
+
+        [[nodiscard]]
+        constexpr bool has_value() const noexcept
+        {
+            return m_Value != sentinel;
+        }
+
+        [[nodiscard]]
+        explicit constexpr operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        constexpr void reset() noexcept
+        {
+            m_Value = sentinel;
+        }
+
+        [[nodiscard]]
+        constexpr T& operator*() & noexcept
+        {
+            GIMO_ASSERT(has_value(), "sentinel_optional must contain a value.");
+
+            return m_Value;
+        }
+
+        [[nodiscard]]
+        constexpr T const& operator*() const& noexcept
+        {
+            GIMO_ASSERT(has_value(), "sentinel_optional must contain a value.");
+
+            return m_Value;
+        }
+
+        [[nodiscard]]
+        constexpr T&& operator*() && noexcept
+        {
+            GIMO_ASSERT(has_value(), "sentinel_optional must contain a value.");
+
+            return std::move(m_Value);
+        }
+
+        [[nodiscard]]
+        constexpr T const&& operator*() const&& noexcept
+        {
+            GIMO_ASSERT(has_value(), "sentinel_optional must contain a value.");
+
+            return std::move(m_Value);
+        }
+
+        template <typename U>
+            requires std::convertible_to<U&&, T>
+        [[nodiscard]]
+        constexpr T value_or(U&& alternative) const
+        {
+            return has_value()
+                     ? m_Value
+                     : static_cast<T>(std::forward<U>(alternative));
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(sentinel_optional const& opt, [[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            return !opt.has_value();
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(sentinel_optional const& lhs, sentinel_optional const& rhs) noexcept
+        {
+            return lhs.m_Value == rhs.m_Value;
+        }
+
+    private:
+        T m_Value{sentinel};
+    };
+}
+
+template <typename T, T sentinel>
+struct gimo::traits<gimo::sentinel_optional<T, sentinel>>
+{
+    static constexpr auto null{std::nullopt};
+
+    [[nodiscard]]
+    static constexpr bool has_value(sentinel_optional<T, sentinel> const& opt) noexcept
+    {
+        return opt.has_value();
+    }
+
+    // Transforms pass their results on without testing them, thus the rebound nullable must be engaged for every value.
+    // Any value may equal a sentinel, hence results are never rebound to a `sentinel_optional`.
+    template <typename V>
+    using rebind_value = detail::rebind_optional_t<V>;
+};
+
+#endif
@@ -0,0 +1,81 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_SIMD_HPP
+#define GIMO_SIMD_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+
+#if defined(GIMO_CONFIG_EXPERIMENTAL_SIMD) && __has_include(<experimental/simd>)
+    #include <experimental/simd>
+    #define GIMO_DETAIL_HAS_EXPERIMENTAL_SIMD 1
+#endif
+
+#if defined(__clang__)
+    #define GIMO_DETAIL_VECTORIZE_LOOP _Pragma("clang loop vectorize(enable)")
+#elif defined(__GNUC__)
+    #define GIMO_DETAIL_VECTORIZE_LOOP _Pragma("GCC ivdep")
+#else
+    #define GIMO_DETAIL_VECTORIZE_LOOP
+#endif
+
+namespace gimo::detail
+{
+#ifdef GIMO_DETAIL_HAS_EXPERIMENTAL_SIMD
+    namespace stdx = std::experimental;
+
+    template <typename Action, typename In, typename Out>
+    concept simd_invocable =
+        std::is_arithmetic_v<In>
+        && std::is_arithmetic_v<Out>
+        && requires(Action& action, stdx::native_simd<In> const& lanes) {
+               { std::invoke(action, lanes) } -> std::same_as<stdx::rebind_simd_t<Out, stdx::native_simd<In>>>;
+           };
+#endif
+
+    // Invokes the action on every input, regardless whether the element is engaged.
+    // Inputs and outputs may either be disjoint or refer to the exact same range.
+    template <typename In, typename Out, typename Action>
+    constexpr void transform_unconditionally(std::span<In const> const inputs, std::span<Out> const outputs, Action& action)
+    {
+        GIMO_ASSERT(inputs.size() <= outputs.size(), "Output must be at least as large as the input.", inputs, outputs);
+
+        std::size_t const count = inputs.size();
+        In const* const in = inputs.data();
+        Out* const out = outputs.data();
+        std::size_t i{};
+
+#ifdef GIMO_DETAIL_HAS_EXPERIMENTAL_SIMD
+        if constexpr (simd_invocable<Action, In, Out>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                using Lanes = stdx::native_simd<In>;
+                for (; i + Lanes::size() <= count; i += Lanes::size())
+                {
+                    Lanes const lanes{in + i, stdx::element_aligned};
+                    std::invoke(action, lanes).copy_to(out + i, stdx::element_aligned);
+                }
+            }
+        }
+#endif
+
+        GIMO_DETAIL_VECTORIZE_LOOP
+        for (; i < count; ++i)
+        {
+            out[i] = static_cast<Out>(std::invoke(action, in[i]));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,112 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_ZIP_HPP
+#define GIMO_ZIP_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    // Combines multiple nullables into a single one, which contains a value, if all of them do.
+    // Its value is a tuple with the references to all contained values, thus it must not outlive the zipped nullables.
+    // Results are rebound like those of the first nullable.
+    template <typename... Nullables>
+        requires(0u < sizeof...(Nullables))
+             && (std::is_reference_v<Nullables> && ...)
+    class zipped
+    {
+    public:
+        using first_type = std::remove_cvref_t<std::tuple_element_t<0u, std::tuple<Nullables...>>>;
+        using value_type = std::tuple<reference_type_t<Nullables>...>;
+
+        [[nodiscard]]
+        explicit(false) constexpr zipped([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+        }
+
+        [[nodiscard]]
+        explicit constexpr zipped(bool const engaged, std::remove_reference_t<Nullables>&... sources) noexcept
+            : m_Engaged{engaged},
+              m_Sources{std::addressof(sources)...}
+        {
+        }
+
+        [[nodiscard]]
+        constexpr bool has_value() const noexcept
+        {
+            return m_Engaged;
+        }
+
+        // The references are forwarded with the qualification of the zipped nullables, like `std::forward_as_tuple` does.
+        [[nodiscard]]
+        constexpr value_type operator*() const
+        {
+            GIMO_ASSERT(has_value(), "zipped must contain a value.");
+
+            return std::apply(
+                [](auto*... sources) { return value_type{gimo::value(static_cast<Nullables&&>(*sources))...}; },
+                m_Sources);
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(zipped const& opt, [[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            return !opt.has_value();
+        }
+
+    private:
+        bool m_Engaged{};
+        std::tuple<std::remove_reference_t<Nullables>*...> m_Sources{};
+    };
+
+    // The engaged-states are combined without short-circuiting, so that the pipeline needs just a single null-test.
+    template <nullable... Nullables>
+        requires(0u < sizeof...(Nullables))
+             && (!fallible<Nullables> && ...)
+    [[nodiscard]]
+    constexpr zipped<Nullables&&...> zip(Nullables&&... opts)
+    {
+        bool const engaged = (static_cast<bool>(detail::has_value(opts)) & ...);
+
+        return zipped<Nullables&&...>{engaged, opts...};
+    }
+}
+
+template <typename... Nullables>
+struct gimo::traits<gimo::zipped<Nullables...>>
+{
+    using first_type = typename zipped<Nullables...>::first_type;
+
+    static constexpr auto null{std::nullopt};
+
+    [[nodiscard]]
+    static constexpr bool has_value(zipped<Nullables...> const& opt) noexcept
+    {
+        return opt.has_value();
+    }
+
+    template <typename V>
+    using rebind_value = rebind_value_t<first_type, V>;
+
+    // The result is directly constructed into the rebound nullable of the first nullable.
+    template <typename Fn, typename... Args>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr auto construct_from_invoke(Fn&& fn, Args&&... args)
+    {
+        return detail::construct_from_invoke<first_type>(GIMO_DETAIL_FORWARD(fn), GIMO_DETAIL_FORWARD(args)...);
+    }
+};
+
+#endif
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "gimo/Common.hpp"
+#include "gimo/Engaged.hpp"
 #include "gimo/Pipeline.hpp"
 #include "gimo/algorithm/BasicAlgorithm.hpp"
 
@@ -22,73 +23,133 @@ namespace gimo::detail::and_then
 {
     template <typename Action, nullable Nullable>
     [[nodiscard]]
-    constexpr auto on_value(Action&& action, Nullable&& opt)
+    GIMO_DETAIL_FLATTEN constexpr auto on_value(Action&& action, Nullable&& opt)
     {
-        return std::invoke(
-            std::forward<Action>(action),
-            gimo::value(std::forward<Nullable>(opt)));
+        if constexpr (known_engaged<std::invoke_result_t<Action, reference_type_t<Nullable>>>)
+        {
+            return detail::invoke(
+                       GIMO_DETAIL_FORWARD(action),
+                       gimo::value(GIMO_DETAIL_FORWARD(opt)))
+                .get();
+        }
+        else
+        {
+            return detail::invoke(
+                GIMO_DETAIL_FORWARD(action),
+                gimo::value(GIMO_DETAIL_FORWARD(opt)));
+        }
     }
 
     template <typename Action, nullable Nullable, typename Next, typename... Steps>
     [[nodiscard]]
-    constexpr auto on_value(
+    GIMO_DETAIL_FLATTEN constexpr auto on_value(
         Action&& action,
         Nullable&& opt,
         Next&& next,
         Steps&&... steps)
     {
-        return std::invoke(
-            std::forward<Next>(next),
-            and_then::on_value(std::forward<Action>(action), std::forward<Nullable>(opt)),
-            std::forward<Steps>(steps)...);
+        // The result of the action is known to be engaged, thus the null-test of the next step can be skipped.
+        if constexpr (known_engaged<std::invoke_result_t<Action, reference_type_t<Nullable>>>)
+        {
+            return GIMO_DETAIL_FORWARD(next).on_value(
+                and_then::on_value(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(opt)),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+        else
+        {
+            return detail::invoke(
+                GIMO_DETAIL_FORWARD(next),
+                and_then::on_value(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(opt)),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
     }
 
     template <nullable Nullable, typename Action>
     [[nodiscard]]
-    constexpr auto on_null([[maybe_unused]] Action&& action)
+    GIMO_DETAIL_FLATTEN constexpr auto on_null([[maybe_unused]] Action&& action)
     {
-        using Result = std::invoke_result_t<Action, reference_type_t<Nullable>>;
+        using Result = unwrap_engaged_t<std::invoke_result_t<Action, reference_type_t<Nullable>>>;
 
         return detail::construct_empty<Result>();
     }
 
     template <nullable Nullable, typename Action, typename Next, typename... Steps>
     [[nodiscard]]
-    constexpr auto on_null([[maybe_unused]] Action&& action, Next&& next, Steps&&... steps)
+    GIMO_DETAIL_FLATTEN constexpr auto on_null([[maybe_unused]] Action&& action, Next&& next, Steps&&... steps)
+    {
+        using Result = decltype(on_null<Nullable>(GIMO_DETAIL_FORWARD(action)));
+
+        return GIMO_DETAIL_FORWARD(next).template on_null<Result>(
+            GIMO_DETAIL_FORWARD(steps)...);
+    }
+
+    template <typename Action, fallible Nullable>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_error([[maybe_unused]] Action&& action, Nullable&& opt)
     {
-        using Result = decltype(on_null<Nullable>(std::forward<Action>(action)));
+        using Result = unwrap_engaged_t<std::invoke_result_t<Action, reference_type_t<Nullable>>>;
 
-        return std::forward<Next>(next).template on_null<Result>(
-            std::forward<Steps>(steps)...);
+        return detail::construct_error<Result>(GIMO_DETAIL_FORWARD(opt));
+    }
+
+    template <typename Action, fallible Nullable, typename Next, typename... Steps>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_error(
+        [[maybe_unused]] Action&& action,
+        Nullable&& opt,
+        Next&& next,
+        Steps&&... steps)
+    {
+        return detail::continue_on_error(
+            and_then::on_error(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(opt)),
+            GIMO_DETAIL_FORWARD(next),
+            GIMO_DETAIL_FORWARD(steps)...);
     }
 
     struct traits
     {
+        static constexpr bool is_null_preserving{true};
+
+        // Nulls can not be turned into errors, thus results without a null-value require a source with an error.
         template <nullable Nullable, typename Action>
         static constexpr bool is_applicable_on = requires {
             requires nullable<
-                std::invoke_result_t<
+                unwrap_engaged_t<std::invoke_result_t<
                     Action,
-                    reference_type_t<Nullable>>>;
+                    reference_type_t<Nullable>>>>;
+            requires fallible<Nullable>
+                         || customized_null<unwrap_engaged_t<std::invoke_result_t<
+                             Action,
+                             reference_type_t<Nullable>>>>;
         };
 
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
-        static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+        GIMO_DETAIL_FLATTEN static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
         {
             return and_then::on_value(
-                std::forward<Action>(action),
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(action),
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <nullable Nullable, typename Action, typename... Steps>
         [[nodiscard]]
-        static constexpr auto on_null(Action&& action, Steps&&... steps)
+        GIMO_DETAIL_FLATTEN static constexpr auto on_null(Action&& action, Steps&&... steps)
         {
             return and_then::on_null<Nullable>(
-                std::forward<Action>(action),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(action),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+
+        template <typename Action, fallible Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN static constexpr auto on_error(Action&& action, Nullable&& opt, Steps&&... steps)
+        {
+            return and_then::on_error(
+                GIMO_DETAIL_FORWARD(action),
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
     };
 }
@@ -18,21 +18,51 @@ namespace gimo
 {
     namespace detail
     {
+        // Must not be `static`, as the exported algorithms of the `gimo` module must not refer to internal entities.
         template <typename Traits, typename Action, typename Nullable, typename... Steps>
         [[nodiscard]]
-        static constexpr auto test_and_execute(Action&& action, Nullable&& opt, Steps&&... steps)
+        GIMO_DETAIL_FLATTEN constexpr auto test_and_execute(Action&& action, Nullable&& opt, Steps&&... steps)
         {
             if (detail::has_value(opt))
             {
                 return Traits::on_value(
-                    std::forward<Action>(action),
-                    std::forward<Nullable>(opt),
-                    std::forward<Steps>(steps)...);
+                    GIMO_DETAIL_FORWARD(action),
+                    GIMO_DETAIL_FORWARD(opt),
+                    GIMO_DETAIL_FORWARD(steps)...);
             }
 
-            return Traits::template on_null<Nullable>(
-                std::forward<Action>(action),
-                std::forward<Steps>(steps)...);
+            if constexpr (fallible<Nullable>)
+            {
+                return Traits::on_error(
+                    GIMO_DETAIL_FORWARD(action),
+                    GIMO_DETAIL_FORWARD(opt),
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
+            else
+            {
+                return Traits::template on_null<Nullable>(
+                    GIMO_DETAIL_FORWARD(action),
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
+        }
+
+        // Continues the error path of a pipeline with the next step.
+        // If the result can not carry the error, the next step continues on the null path instead.
+        template <nullable Result, typename Next, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr auto continue_on_error(Result&& result, Next&& next, Steps&&... steps)
+        {
+            if constexpr (fallible<Result>)
+            {
+                return GIMO_DETAIL_FORWARD(next).on_error(
+                    GIMO_DETAIL_FORWARD(result),
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
+            else
+            {
+                return GIMO_DETAIL_FORWARD(next).template on_null<std::remove_cvref_t<Result>>(
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
         }
 
         template <typename Nullable, typename Traits, typename Action>
@@ -57,132 +87,204 @@ namespace gimo
         template <typename... Args>
             requires std::constructible_from<Action, Args&&...>
         [[nodiscard]] explicit constexpr BasicAlgorithm(Args&&... args) noexcept(std::is_nothrow_constructible_v<Action, Args&&...>)
-            : m_Action{std::forward<Args>(args)...}
+            : m_Action{GIMO_DETAIL_FORWARD(args)...}
         {
         }
 
         template <applicable_on<BasicAlgorithm&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto operator()(Nullable&& opt, Steps&&... steps) &
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Nullable&& opt, Steps&&... steps) &
         {
             return detail::test_and_execute<Traits>(
                 m_Action,
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm const&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto operator()(Nullable&& opt, Steps&&... steps) const&
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Nullable&& opt, Steps&&... steps) const&
         {
             return detail::test_and_execute<Traits>(
                 m_Action,
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm&&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto operator()(Nullable&& opt, Steps&&... steps) &&
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Nullable&& opt, Steps&&... steps) &&
         {
             return detail::test_and_execute<Traits>(
                 std::move(m_Action),
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm const&&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto operator()(Nullable&& opt, Steps&&... steps) const&&
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Nullable&& opt, Steps&&... steps) const&&
         {
             return detail::test_and_execute<Traits>(
                 std::move(m_Action),
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto on_value(Nullable&& opt, Steps&&... steps) &
+        GIMO_DETAIL_FLATTEN constexpr auto on_value(Nullable&& opt, Steps&&... steps) &
         {
             GIMO_ASSERT(detail::has_value(opt), "Nullable must contain a value.", opt);
 
             return Traits::on_value(
                 m_Action,
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm const&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto on_value(Nullable&& opt, Steps&&... steps) const&
+        GIMO_DETAIL_FLATTEN constexpr auto on_value(Nullable&& opt, Steps&&... steps) const&
         {
             GIMO_ASSERT(detail::has_value(opt), "Nullable must contain a value.", opt);
 
             return Traits::on_value(
                 m_Action,
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm&&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto on_value(Nullable&& opt, Steps&&... steps) &&
+        GIMO_DETAIL_FLATTEN constexpr auto on_value(Nullable&& opt, Steps&&... steps) &&
         {
             GIMO_ASSERT(detail::has_value(opt), "Nullable must contain a value.", opt);
 
             return Traits::on_value(
                 std::move(m_Action),
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm const&&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto on_value(Nullable&& opt, Steps&&... steps) const&&
+        GIMO_DETAIL_FLATTEN constexpr auto on_value(Nullable&& opt, Steps&&... steps) const&&
         {
             GIMO_ASSERT(detail::has_value(opt), "Nullable must contain a value.", opt);
 
             return Traits::on_value(
                 std::move(m_Action),
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto on_null(Steps&&... steps) &
+        GIMO_DETAIL_FLATTEN constexpr auto on_error(Nullable&& opt, Steps&&... steps) &
+        {
+            GIMO_ASSERT(!detail::has_value(opt), "Nullable must contain an error.", opt);
+
+            return Traits::on_error(
+                m_Action,
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+
+        template <applicable_on<BasicAlgorithm const&> Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr auto on_error(Nullable&& opt, Steps&&... steps) const&
+        {
+            GIMO_ASSERT(!detail::has_value(opt), "Nullable must contain an error.", opt);
+
+            return Traits::on_error(
+                m_Action,
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+
+        template <applicable_on<BasicAlgorithm&&> Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr auto on_error(Nullable&& opt, Steps&&... steps) &&
+        {
+            GIMO_ASSERT(!detail::has_value(opt), "Nullable must contain an error.", opt);
+
+            return Traits::on_error(
+                std::move(m_Action),
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+
+        template <applicable_on<BasicAlgorithm const&&> Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr auto on_error(Nullable&& opt, Steps&&... steps) const&&
+        {
+            GIMO_ASSERT(!detail::has_value(opt), "Nullable must contain an error.", opt);
+
+            return Traits::on_error(
+                std::move(m_Action),
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+
+        template <applicable_on<BasicAlgorithm&> Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr auto on_null(Steps&&... steps) &
         {
             return Traits::template on_null<Nullable>(
                 m_Action,
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm const&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto on_null(Steps&&... steps) const&
+        GIMO_DETAIL_FLATTEN constexpr auto on_null(Steps&&... steps) const&
         {
             return Traits::template on_null<Nullable>(
                 m_Action,
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm&&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto on_null(Steps&&... steps) &&
+        GIMO_DETAIL_FLATTEN constexpr auto on_null(Steps&&... steps) &&
         {
             return Traits::template on_null<Nullable>(
                 std::move(m_Action),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <applicable_on<BasicAlgorithm const&&> Nullable, typename... Steps>
         [[nodiscard]]
-        constexpr auto on_null(Steps&&... steps) const&&
+        GIMO_DETAIL_FLATTEN constexpr auto on_null(Steps&&... steps) const&&
         {
             return Traits::template on_null<Nullable>(
                 std::move(m_Action),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr Action& action() & noexcept
+        {
+            return m_Action;
+        }
+
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr Action const& action() const& noexcept
+        {
+            return m_Action;
+        }
+
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr Action&& action() && noexcept
+        {
+            return std::move(m_Action);
+        }
+
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN constexpr Action const&& action() const&& noexcept
+        {
+            return std::move(m_Action);
         }
 
     private:
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "gimo/Common.hpp"
+#include "gimo/Engaged.hpp"
 #include "gimo/Pipeline.hpp"
 #include "gimo/algorithm/BasicAlgorithm.hpp"
 
@@ -22,67 +23,161 @@ namespace gimo::detail::or_else
 {
     template <typename Action, nullable Nullable>
     [[nodiscard]]
-    constexpr auto on_value([[maybe_unused]] Action&& action, Nullable&& opt)
+    GIMO_DETAIL_FLATTEN constexpr auto on_value([[maybe_unused]] Action&& action, Nullable&& opt)
     {
-        return std::forward<Nullable>(opt);
+        return GIMO_DETAIL_FORWARD(opt);
     }
 
     template <typename Action, nullable Nullable, typename Next, typename... Steps>
     [[nodiscard]]
-    constexpr auto on_value(
+    GIMO_DETAIL_FLATTEN constexpr auto on_value(
         [[maybe_unused]] Action&& action,
         Nullable&& opt,
         Next&& next,
         Steps&&... steps)
     {
-        return std::forward<Next>(next).on_value(
-            std::forward<Nullable>(opt),
-            std::forward<Steps>(steps)...);
+        return GIMO_DETAIL_FORWARD(next).on_value(
+            GIMO_DETAIL_FORWARD(opt),
+            GIMO_DETAIL_FORWARD(steps)...);
+    }
+
+    // Fallbacks for nullables with an error may either ignore or receive that error.
+    template <typename Action, typename Nullable>
+    struct fallback_result
+    {
+    };
+
+    template <typename Action, typename Nullable>
+        requires std::invocable<Action>
+    struct fallback_result<Action, Nullable>
+    {
+        using type = std::invoke_result_t<Action>;
+    };
+
+    template <typename Action, fallible Nullable>
+        requires(!std::invocable<Action>)
+             && std::invocable<Action, error_type_t<Nullable>>
+    struct fallback_result<Action, Nullable>
+    {
+        using type = std::invoke_result_t<Action, error_type_t<Nullable>>;
+    };
+
+    template <typename Action, typename Nullable>
+    using fallback_result_t = typename fallback_result<Action, Nullable>::type;
+
+    template <typename Action, typename... Args>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto invoke_fallback(Action&& action, Args&&... args)
+    {
+        if constexpr (known_engaged<std::invoke_result_t<Action, Args...>>)
+        {
+            return detail::invoke(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(args)...).get();
+        }
+        else
+        {
+            return detail::invoke(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(args)...);
+        }
+    }
+
+    template <typename ActionResult, typename Next, typename Fallback, typename... Steps>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto continue_with_fallback(Next&& next, Fallback&& fallback, Steps&&... steps)
+    {
+        // The fallback is known to be engaged, thus the null-test of the next step can be skipped.
+        if constexpr (known_engaged<ActionResult>)
+        {
+            return GIMO_DETAIL_FORWARD(next).on_value(
+                GIMO_DETAIL_FORWARD(fallback),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+        else
+        {
+            return detail::invoke(
+                GIMO_DETAIL_FORWARD(next),
+                GIMO_DETAIL_FORWARD(fallback),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
     }
 
     template <nullable Nullable, typename Action>
     [[nodiscard]]
-    constexpr auto on_null(Action&& action)
+    GIMO_DETAIL_FLATTEN constexpr auto on_null(Action&& action)
     {
-        return std::invoke(std::forward<Action>(action));
+        return or_else::invoke_fallback(GIMO_DETAIL_FORWARD(action));
     }
 
     template <nullable Nullable, typename Action, typename Next, typename... Steps>
     [[nodiscard]]
-    constexpr auto on_null(Action&& action, Next&& next, Steps&&... steps)
+    GIMO_DETAIL_FLATTEN constexpr auto on_null(Action&& action, Next&& next, Steps&&... steps)
     {
-        return std::invoke(
-            std::forward<Next>(next),
-            or_else::on_null<Nullable>(std::forward<Action>(action)),
-            std::forward<Steps>(steps)...);
+        return or_else::continue_with_fallback<std::invoke_result_t<Action>>(
+            GIMO_DETAIL_FORWARD(next),
+            or_else::on_null<Nullable>(GIMO_DETAIL_FORWARD(action)),
+            GIMO_DETAIL_FORWARD(steps)...);
+    }
+
+    template <typename Action, fallible Nullable>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_error(Action&& action, [[maybe_unused]] Nullable&& opt)
+    {
+        if constexpr (std::invocable<Action>)
+        {
+            return or_else::invoke_fallback(GIMO_DETAIL_FORWARD(action));
+        }
+        else
+        {
+            return or_else::invoke_fallback(GIMO_DETAIL_FORWARD(action), gimo::error(GIMO_DETAIL_FORWARD(opt)));
+        }
+    }
+
+    template <typename Action, fallible Nullable, typename Next, typename... Steps>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_error(Action&& action, Nullable&& opt, Next&& next, Steps&&... steps)
+    {
+        return or_else::continue_with_fallback<fallback_result_t<Action, Nullable>>(
+            GIMO_DETAIL_FORWARD(next),
+            or_else::on_error(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(opt)),
+            GIMO_DETAIL_FORWARD(steps)...);
     }
 
     struct traits
     {
+        static constexpr bool is_null_preserving{false};
+
         template <nullable Nullable, typename Action>
         static constexpr bool is_applicable_on = requires {
             requires std::same_as<
                 std::remove_cvref_t<Nullable>,
-                std::remove_cvref_t<std::invoke_result_t<Action>>>;
+                std::remove_cvref_t<unwrap_engaged_t<fallback_result_t<Action, Nullable>>>>;
         };
 
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
-        static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+        GIMO_DETAIL_FLATTEN static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
         {
             return or_else::on_value(
-                std::forward<Action>(action),
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(action),
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
 
         template <nullable Nullable, typename Action, typename... Steps>
         [[nodiscard]]
-        static constexpr auto on_null(Action&& action, Steps&&... steps)
+        GIMO_DETAIL_FLATTEN static constexpr auto on_null(Action&& action, Steps&&... steps)
         {
             return or_else::on_null<Nullable>(
-                std::forward<Action>(action),
-                std::forward<Steps>(steps)...);
+                GIMO_DETAIL_FORWARD(action),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+
+        template <typename Action, fallible Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN static constexpr auto on_error(Action&& action, Nullable&& opt, Steps&&... steps)
+        {
+            return or_else::on_error(
+                GIMO_DETAIL_FORWARD(action),
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
         }
     };
 }
@@ -3,16 +3,19 @@
 //     (See accompanying file LICENSE_1_0.txt or copy at
 //           https://www.boost.org/LICENSE_1_0.txt)
 
-#ifndef GIMO_ALGORITHM_AND_THEN_HPP
-#define GIMO_ALGORITHM_AND_THEN_HPP
+#ifndef GIMO_ALGORITHM_TRANSFORM_HPP
+#define GIMO_ALGORITHM_TRANSFORM_HPP
 
 #pragma once
 
 #include "gimo/Common.hpp"
+#include "gimo/OptionalRef.hpp"
 #include "gimo/Pipeline.hpp"
+#include "gimo/Pure.hpp"
 #include "gimo/algorithm/BasicAlgorithm.hpp"
 
 #include <concepts>
+#include <cstddef>
 #include <functional>
 #include <tuple>
 #include <type_traits>
@@ -22,30 +25,42 @@ namespace gimo::detail::transform
 {
     template <typename Action, nullable Nullable>
     [[nodiscard]]
-    constexpr auto on_value([[maybe_unused]] Action&& action, Nullable&& opt)
+    GIMO_DETAIL_FLATTEN constexpr auto on_value([[maybe_unused]] Action&& action, Nullable&& opt)
     {
-        return detail::rebind_value<Nullable>(
-            std::invoke(
-                std::forward<Action>(action),
-                value(std::forward<Nullable>(opt))));
+        using Result = std::invoke_result_t<Action, reference_type_t<Nullable>>;
+
+        // Traits, which customize the rebinding of references, receive the source, e.g. to share its ownership.
+        // Thus, the value is only accessed as lvalue here.
+        if constexpr (customized_rebind_reference<Nullable, Result>)
+        {
+            Result ref = detail::invoke(GIMO_DETAIL_FORWARD(action), value(opt));
+
+            return traits<std::remove_cvref_t<Nullable>>::rebind_reference(GIMO_DETAIL_FORWARD(opt), ref);
+        }
+        else
+        {
+            return detail::construct_from_invoke<Nullable>(
+                GIMO_DETAIL_FORWARD(action),
+                value(GIMO_DETAIL_FORWARD(opt)));
+        }
     }
 
     template <typename Action, nullable Nullable, typename Next, typename... Steps>
     [[nodiscard]]
-    constexpr auto on_value(
+    GIMO_DETAIL_FLATTEN constexpr auto on_value(
         [[maybe_unused]] Action&& action,
         Nullable&& opt,
         Next&& next,
         Steps&&... steps)
     {
-        return std::forward<Next>(next).on_value(
-            transform::on_value(std::forward<Action>(action), std::forward<Nullable>(opt)),
-            std::forward<Steps>(steps)...);
+        return GIMO_DETAIL_FORWARD(next).on_value(
+            transform::on_value(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(opt)),
+            GIMO_DETAIL_FORWARD(steps)...);
     }
 
     template <nullable Nullable, typename Action>
     [[nodiscard]]
-    constexpr auto on_null([[maybe_unused]] Action&& action)
+    GIMO_DETAIL_FLATTEN constexpr auto on_null([[maybe_unused]] Action&& action)
     {
         using Result = std::invoke_result_t<Action, reference_type_t<Nullable>>;
 
@@ -54,40 +69,339 @@ namespace gimo::detail::transform
 
     template <nullable Nullable, typename Action, typename Next, typename... Steps>
     [[nodiscard]]
-    constexpr auto on_null([[maybe_unused]] Action&& action, Next&& next, Steps&&... steps)
+    GIMO_DETAIL_FLATTEN constexpr auto on_null([[maybe_unused]] Action&& action, Next&& next, Steps&&... steps)
     {
-        using Result = decltype(transform::on_null<Nullable>(std::forward<Action>(action)));
+        using Result = decltype(transform::on_null<Nullable>(GIMO_DETAIL_FORWARD(action)));
 
-        return std::forward<Next>(next).template on_null<Result>(
-            std::forward<Steps>(steps)...);
+        return GIMO_DETAIL_FORWARD(next).template on_null<Result>(
+            GIMO_DETAIL_FORWARD(steps)...);
     }
 
-    struct traits
+    template <typename Action, fallible Nullable>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_error([[maybe_unused]] Action&& action, Nullable&& opt)
     {
-        template <nullable Nullable, typename Action>
-        static constexpr bool is_applicable_on = requires {
+        using Result = std::invoke_result_t<Action, reference_type_t<Nullable>>;
+
+        return detail::construct_error<rebind_value_t<Nullable, Result>>(GIMO_DETAIL_FORWARD(opt));
+    }
+
+    template <typename Action, fallible Nullable, typename Next, typename... Steps>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_error(
+        [[maybe_unused]] Action&& action,
+        Nullable&& opt,
+        Next&& next,
+        Steps&&... steps)
+    {
+        return detail::continue_on_error(
+            transform::on_error(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(opt)),
+            GIMO_DETAIL_FORWARD(next),
+            GIMO_DETAIL_FORWARD(steps)...);
+    }
+
+    template <typename First, typename Second, typename... Args>
+    using composition_result_t = std::invoke_result_t<Second, std::invoke_result_t<First, Args...>>;
+
+    template <unqualified First, unqualified Second>
+    class composition
+    {
+    public:
+        template <typename FirstArg, typename SecondArg>
+            requires std::constructible_from<First, FirstArg&&>
+                  && std::constructible_from<Second, SecondArg&&>
+        [[nodiscard]]
+        explicit constexpr composition(FirstArg&& first, SecondArg&& second)
+            : m_First{GIMO_DETAIL_FORWARD(first)},
+              m_Second{GIMO_DETAIL_FORWARD(second)}
+        {
+        }
+
+        template <typename... Args>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Args&&... args) & -> composition_result_t<First&, Second&, Args&&...>
+        {
+            return invoke(*this, GIMO_DETAIL_FORWARD(args)...);
+        }
+
+        template <typename... Args>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Args&&... args) const& -> composition_result_t<First const&, Second const&, Args&&...>
+        {
+            return invoke(*this, GIMO_DETAIL_FORWARD(args)...);
+        }
+
+        template <typename... Args>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Args&&... args) && -> composition_result_t<First&&, Second&&, Args&&...>
+        {
+            return invoke(std::move(*this), GIMO_DETAIL_FORWARD(args)...);
+        }
+
+        template <typename... Args>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Args&&... args) const&& -> composition_result_t<First const&&, Second const&&, Args&&...>
+        {
+            return invoke(std::move(*this), GIMO_DETAIL_FORWARD(args)...);
+        }
+
+        template <typename Self>
+        [[nodiscard]]
+        GIMO_DETAIL_INTRINSIC static constexpr auto&& first(Self&& self) noexcept
+        {
+            return detail::forward_like<Self>(self.m_First);
+        }
+
+        template <typename Self>
+        [[nodiscard]]
+        GIMO_DETAIL_INTRINSIC static constexpr auto&& second(Self&& self) noexcept
+        {
+            return detail::forward_like<Self>(self.m_Second);
+        }
+
+    private:
+        [[no_unique_address]] First m_First;
+        [[no_unique_address]] Second m_Second;
+
+        template <typename Self, typename... Args>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN static constexpr decltype(auto) invoke(Self&& self, Args&&... args)
+        {
+            return detail::invoke(
+                detail::forward_like<Self>(self.m_Second),
+                detail::invoke(
+                    detail::forward_like<Self>(self.m_First),
+                    GIMO_DETAIL_FORWARD(args)...));
+        }
+    };
+
+    template <typename Action>
+    struct is_composition
+        : public std::false_type
+    {
+    };
+
+    template <typename First, typename Second>
+    struct is_composition<composition<First, Second>>
+        : public std::true_type
+    {
+    };
+
+    template <typename Action>
+    concept composed = is_composition<std::remove_cvref_t<Action>>::value;
+
+    template <composed Action>
+    using first_action_t = decltype(std::remove_cvref_t<Action>::first(std::declval<Action>()));
+
+    template <composed Action>
+    using second_action_t = decltype(std::remove_cvref_t<Action>::second(std::declval<Action>()));
+
+    // The nullable, which is yielded by the transform. Composed actions yield what their steps would yield in sequence.
+    template <typename Action, typename Nullable>
+    struct result
+    {
+        using type = rebind_value_t<Nullable, std::invoke_result_t<Action, reference_type_t<Nullable>>>;
+    };
+
+    template <composed Action, typename Nullable>
+    struct result<Action, Nullable>
+    {
+        using intermediate_type = typename result<first_action_t<Action>, Nullable>::type;
+        using type = typename result<second_action_t<Action>, intermediate_type>::type;
+    };
+
+    template <typename Action, typename Nullable>
+    using result_t = typename result<Action, Nullable>::type;
+
+    // Composed actions may only skip the intermediate nullable, if that is known to always hold a value and if the
+    // final result is rebound to the same nullable either way. Otherwise, the composed steps are executed in sequence.
+    template <typename Action, typename Nullable>
+    struct fusion
+    {
+        static constexpr bool value{true};
+    };
+
+    template <composed Action, typename Nullable>
+    struct fusion<Action, Nullable>
+    {
+        using intermediate_type = typename result<Action, Nullable>::intermediate_type;
+
+        static constexpr bool value = requires {
+            requires is_rebound_optional<intermediate_type>::value;
+            requires fusion<first_action_t<Action>, Nullable>::value;
+            requires fusion<second_action_t<Action>, intermediate_type>::value;
+            requires std::same_as<
+                result_t<Action, Nullable>,
+                rebind_value_t<Nullable, std::invoke_result_t<Action, reference_type_t<Nullable>>>>;
+        };
+    };
+
+    template <typename Action, typename Nullable>
+    concept staged = composed<Action> && !fusion<Action, Nullable>::value;
+
+    template <typename T>
+    concept tuple_like = requires { std::tuple_size<std::remove_cvref_t<T>>::value; };
+
+    template <typename Action, typename Tuple, typename Indices = std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<Tuple>>>>
+    struct spread_result;
+
+    template <typename Action, typename Tuple, std::size_t... indices>
+        requires std::invocable<Action, decltype(std::get<indices>(std::declval<Tuple>()))...>
+    struct spread_result<Action, Tuple, std::index_sequence<indices...>>
+    {
+        using type = std::invoke_result_t<Action, decltype(std::get<indices>(std::declval<Tuple>()))...>;
+    };
+
+    template <typename Action, typename Tuple>
+    using spread_result_t = typename spread_result<Action, Tuple>::type;
+
+    // Invokes the action with each element of a tuple-like argument, like `std::apply` does.
+    template <unqualified Action>
+    class spread
+    {
+    public:
+        template <typename Arg>
+            requires std::constructible_from<Action, Arg&&>
+        [[nodiscard]]
+        explicit constexpr spread(Arg&& action)
+            : m_Action{GIMO_DETAIL_FORWARD(action)}
+        {
+        }
+
+        template <tuple_like Tuple>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Tuple&& tuple) & -> spread_result_t<Action&, Tuple&&>
+        {
+            return invoke(*this, GIMO_DETAIL_FORWARD(tuple));
+        }
+
+        template <tuple_like Tuple>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Tuple&& tuple) const& -> spread_result_t<Action const&, Tuple&&>
+        {
+            return invoke(*this, GIMO_DETAIL_FORWARD(tuple));
+        }
+
+        template <tuple_like Tuple>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Tuple&& tuple) && -> spread_result_t<Action&&, Tuple&&>
+        {
+            return invoke(std::move(*this), GIMO_DETAIL_FORWARD(tuple));
+        }
+
+        template <tuple_like Tuple>
+        GIMO_DETAIL_FLATTEN constexpr auto operator()(Tuple&& tuple) const&& -> spread_result_t<Action const&&, Tuple&&>
+        {
+            return invoke(std::move(*this), GIMO_DETAIL_FORWARD(tuple));
+        }
+
+    private:
+        [[no_unique_address]] Action m_Action;
+
+        template <typename Self, typename Tuple>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN static constexpr decltype(auto) invoke(Self&& self, Tuple&& tuple)
+        {
+            return [&]<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const seq) -> decltype(auto) {
+                return detail::invoke(
+                    detail::forward_like<Self>(self.m_Action),
+                    std::get<indices>(GIMO_DETAIL_FORWARD(tuple))...);
+            }(std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<Tuple>>>{});
+        }
+    };
+
+    template <typename Nullable, typename Action>
+    struct applicability
+    {
+        static constexpr bool value = requires {
             requires rebindable_to<
                 std::invoke_result_t<Action, reference_type_t<Nullable>>,
                 std::remove_cvref_t<Nullable>>;
         };
+    };
+
+    template <typename Nullable, composed Action>
+    struct applicability<Nullable, Action>
+    {
+        static constexpr bool value = requires {
+            requires applicability<Nullable, first_action_t<Action>>::value;
+            requires applicability<result_t<first_action_t<Action>, Nullable>, second_action_t<Action>>::value;
+        };
+    };
+
+    struct traits
+    {
+        static constexpr bool is_null_preserving{true};
+
+        template <nullable Nullable, typename Action>
+        static constexpr bool is_applicable_on = applicability<Nullable, Action>::value;
 
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
-        static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+        GIMO_DETAIL_FLATTEN static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
         {
-            return transform::on_value(
-                std::forward<Action>(action),
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+            if constexpr (staged<Action, Nullable>)
+            {
+                using Composition = std::remove_cvref_t<Action>;
+
+                return traits::on_value(
+                    Composition::second(GIMO_DETAIL_FORWARD(action)),
+                    traits::on_value(Composition::first(GIMO_DETAIL_FORWARD(action)), GIMO_DETAIL_FORWARD(opt)),
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
+            else
+            {
+                return transform::on_value(
+                    GIMO_DETAIL_FORWARD(action),
+                    GIMO_DETAIL_FORWARD(opt),
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
         }
 
         template <nullable Nullable, typename Action, typename... Steps>
         [[nodiscard]]
-        static constexpr auto on_null(Action&& action, Steps&&... steps)
+        GIMO_DETAIL_FLATTEN static constexpr auto on_null(Action&& action, Steps&&... steps)
         {
-            return transform::on_null<Nullable>(
-                std::forward<Action>(action),
-                std::forward<Steps>(steps)...);
+            if constexpr (staged<Action, Nullable>)
+            {
+                using Composition = std::remove_cvref_t<Action>;
+
+                return traits::on_null<result_t<first_action_t<Action>, Nullable>>(
+                    Composition::second(GIMO_DETAIL_FORWARD(action)),
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
+            else
+            {
+                return transform::on_null<Nullable>(
+                    GIMO_DETAIL_FORWARD(action),
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
+        }
+
+        template <typename Action, fallible Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN static constexpr auto on_error(Action&& action, Nullable&& opt, Steps&&... steps)
+        {
+            if constexpr (staged<Action, Nullable>)
+            {
+                using Composition = std::remove_cvref_t<Action>;
+                using Intermediate = result_t<first_action_t<Action>, Nullable>;
+
+                // Like `detail::continue_on_error`, the error is dropped, if the intermediate nullable can not carry it.
+                if constexpr (fallible<Intermediate>)
+                {
+                    return traits::on_error(
+                        Composition::second(GIMO_DETAIL_FORWARD(action)),
+                        traits::on_error(Composition::first(GIMO_DETAIL_FORWARD(action)), GIMO_DETAIL_FORWARD(opt)),
+                        GIMO_DETAIL_FORWARD(steps)...);
+                }
+                else
+                {
+                    return traits::on_null<Intermediate>(
+                        Composition::second(GIMO_DETAIL_FORWARD(action)),
+                        GIMO_DETAIL_FORWARD(steps)...);
+                }
+            }
+            else
+            {
+                return transform::on_error(
+                    GIMO_DETAIL_FORWARD(action),
+                    GIMO_DETAIL_FORWARD(opt),
+                    GIMO_DETAIL_FORWARD(steps)...);
+            }
         }
     };
 }
@@ -98,6 +412,35 @@ namespace gimo
     {
         template <typename Action>
         using transform_t = BasicAlgorithm<transform::traits, std::remove_cvref_t<Action>>;
+
+        template <typename First, typename Second>
+        struct is_pure_action<transform::composition<First, Second>>
+            : public std::bool_constant<is_pure_action<First>::value && is_pure_action<Second>::value>
+        {
+        };
+
+        template <typename Action>
+        struct is_pure_action<transform::spread<Action>>
+            : public is_pure_action<Action>
+        {
+        };
+
+        template <typename FirstAction, typename SecondAction>
+        struct step_fusion<
+            BasicAlgorithm<transform::traits, FirstAction>,
+            BasicAlgorithm<transform::traits, SecondAction>>
+        {
+            template <typename First, typename Second>
+            [[nodiscard]]
+            static constexpr auto fuse(First&& first, Second&& second)
+            {
+                using Fused = transform_t<transform::composition<FirstAction, SecondAction>>;
+
+                return Fused{
+                    std::forward<First>(first).action(),
+                    std::forward<Second>(second).action()};
+            }
+        };
     }
 
     template <typename Action>
@@ -108,6 +451,16 @@ namespace gimo
 
         return Pipeline{std::tuple<Algorithm>{std::forward<Action>(action)}};
     }
+
+    // Transforms the value of a zipped nullable (see `gimo::zip`) by invoking the action with each of its references.
+    template <typename Action>
+    [[nodiscard]]
+    constexpr auto transform_n(Action&& action)
+    {
+        using Algorithm = detail::transform_t<detail::transform::spread<std::remove_cvref_t<Action>>>;
+
+        return Pipeline{std::tuple<Algorithm>{std::forward<Action>(action)}};
+    }
 }
 
 #endif
@@ -0,0 +1,124 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_ALGORITHM_TRANSFORM_ERROR_HPP
+#define GIMO_ALGORITHM_TRANSFORM_ERROR_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/BasicAlgorithm.hpp"
+
+#include <concepts>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace gimo::detail::transform_error
+{
+    template <typename Action, fallible Nullable>
+    using result_t = rebind_error_t<
+        Nullable,
+        std::remove_cv_t<std::invoke_result_t<Action, error_type_t<Nullable>>>>;
+
+    template <typename Action, fallible Nullable>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_value([[maybe_unused]] Action&& action, Nullable&& opt)
+    {
+        return result_t<Action, Nullable>{gimo::value(GIMO_DETAIL_FORWARD(opt))};
+    }
+
+    // The value is merely passed through, thus the null-test of the next step can be skipped.
+    template <typename Action, fallible Nullable, typename Next, typename... Steps>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_value(
+        [[maybe_unused]] Action&& action,
+        Nullable&& opt,
+        Next&& next,
+        Steps&&... steps)
+    {
+        return GIMO_DETAIL_FORWARD(next).on_value(
+            transform_error::on_value(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(opt)),
+            GIMO_DETAIL_FORWARD(steps)...);
+    }
+
+    template <typename Action, fallible Nullable>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_error(Action&& action, Nullable&& opt)
+    {
+        using Result = result_t<Action, Nullable>;
+
+        return traits<Result>::construct_from_error(
+            detail::invoke(
+                GIMO_DETAIL_FORWARD(action),
+                gimo::error(GIMO_DETAIL_FORWARD(opt))));
+    }
+
+    template <typename Action, fallible Nullable, typename Next, typename... Steps>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN constexpr auto on_error(Action&& action, Nullable&& opt, Next&& next, Steps&&... steps)
+    {
+        return GIMO_DETAIL_FORWARD(next).on_error(
+            transform_error::on_error(GIMO_DETAIL_FORWARD(action), GIMO_DETAIL_FORWARD(opt)),
+            GIMO_DETAIL_FORWARD(steps)...);
+    }
+
+    struct traits
+    {
+        static constexpr bool is_null_preserving{true};
+
+        template <nullable Nullable, typename Action>
+        static constexpr bool is_applicable_on = requires {
+            requires fallible<Nullable>;
+            requires fallible<result_t<Action, Nullable>>;
+            requires customized_construct_from_error<
+                result_t<Action, Nullable>,
+                std::invoke_result_t<Action, error_type_t<Nullable>>>;
+        };
+
+        template <typename Action, fallible Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+        {
+            return transform_error::on_value(
+                GIMO_DETAIL_FORWARD(action),
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+
+        template <typename Action, fallible Nullable, typename... Steps>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN static constexpr auto on_error(Action&& action, Nullable&& opt, Steps&&... steps)
+        {
+            return transform_error::on_error(
+                GIMO_DETAIL_FORWARD(action),
+                GIMO_DETAIL_FORWARD(opt),
+                GIMO_DETAIL_FORWARD(steps)...);
+        }
+    };
+}
+
+namespace gimo
+{
+    namespace detail
+    {
+        template <typename Action>
+        using transform_error_t = BasicAlgorithm<transform_error::traits, std::remove_cvref_t<Action>>;
+    }
+
+    // Transforms the error of nullables, which carry one (e.g. `std::expected`), and passes values through.
+    template <typename Action>
+    [[nodiscard]]
+    constexpr auto transform_error(Action&& action)
+    {
+        using Algorithm = detail::transform_error_t<Action>;
+
+        return Pipeline{std::tuple<Algorithm>{std::forward<Action>(action)}};
+    }
+}
+
+#endif
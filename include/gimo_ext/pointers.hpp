@@ -0,0 +1,126 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_POINTERS_HPP
+#define GIMO_EXT_POINTERS_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/OptionalRef.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace gimo::detail
+{
+    // Rebinds lvalue-references to raw pointers and everything else to `std::optional`.
+    template <typename V>
+    struct rebind_pointer
+    {
+        using type = rebind_optional_t<V>;
+    };
+
+    template <typename V>
+    struct rebind_pointer<V&>
+    {
+        using type = V*;
+    };
+
+    template <typename V>
+    using rebind_pointer_t = typename rebind_pointer<V>::type;
+
+    // Shares the ownership of the source with the referred object, like the aliasing constructor does.
+    // Everything else is rebound to `std::optional`, as a new control block would be allocated otherwise.
+    template <typename V>
+    struct rebind_shared_ptr
+    {
+        using type = rebind_optional_t<V>;
+    };
+
+    template <typename V>
+    struct rebind_shared_ptr<V&>
+    {
+        using type = std::shared_ptr<V>;
+    };
+
+    struct pointer_traits_base
+    {
+        static constexpr std::nullptr_t null{nullptr};
+
+        // Actions returning lvalue-references yield a pointer to the referred object.
+        template <typename Fn, typename... Args>
+            requires std::is_lvalue_reference_v<std::invoke_result_t<Fn, Args...>>
+        [[nodiscard]]
+        GIMO_DETAIL_FLATTEN static constexpr auto construct_from_invoke(Fn&& fn, Args&&... args)
+        {
+            return std::addressof(detail::invoke(GIMO_DETAIL_FORWARD(fn), GIMO_DETAIL_FORWARD(args)...));
+        }
+    };
+}
+
+template <typename T>
+    requires std::is_object_v<T>
+struct gimo::traits<T*>
+    : public gimo::detail::pointer_traits_base
+{
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr bool has_value(T* const ptr) noexcept
+    {
+        return ptr != nullptr;
+    }
+
+    template <typename V>
+    using rebind_value = detail::rebind_pointer_t<V>;
+};
+
+// References into the pointee are rebound to raw pointers, as the ownership can not be shared.
+template <typename T, typename Deleter>
+struct gimo::traits<std::unique_ptr<T, Deleter>>
+    : public gimo::detail::pointer_traits_base
+{
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr bool has_value(std::unique_ptr<T, Deleter> const& ptr) noexcept
+    {
+        return static_cast<bool>(ptr);
+    }
+
+    template <typename V>
+    using rebind_value = detail::rebind_pointer_t<V>;
+};
+
+template <typename T>
+struct gimo::traits<std::shared_ptr<T>>
+{
+    static constexpr std::nullptr_t null{nullptr};
+
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static inline bool has_value(std::shared_ptr<T> const& ptr) noexcept
+    {
+        return static_cast<bool>(ptr);
+    }
+
+    template <typename V>
+    using rebind_value = typename detail::rebind_shared_ptr<V>::type;
+
+    template <typename V>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static inline std::shared_ptr<V> rebind_reference(std::shared_ptr<T> const& source, V& ref) noexcept
+    {
+        return std::shared_ptr<V>{source, std::addressof(ref)};
+    }
+
+    template <typename V>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static inline std::shared_ptr<V> rebind_reference(std::shared_ptr<T>&& source, V& ref) noexcept
+    {
+        return std::shared_ptr<V>{std::move(source), std::addressof(ref)};
+    }
+};
+
+#endif
@@ -0,0 +1,92 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_STD_EXPECTED_HPP
+#define GIMO_EXT_STD_EXPECTED_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+
+#include <version>
+
+#ifdef __cpp_lib_expected
+
+    #include <concepts>
+    #include <expected>
+    #include <functional>
+    #include <type_traits>
+    #include <utility>
+
+namespace gimo::detail
+{
+    // `std::expected` can not hold references, thus lvalue-references are rebound to `std::reference_wrapper`.
+    template <typename V, typename E>
+    struct rebind_expected
+    {
+        using type = std::expected<std::remove_reference_t<V>, E>;
+    };
+
+    template <typename V, typename E>
+    struct rebind_expected<V&, E>
+    {
+        using type = std::expected<std::reference_wrapper<V>, E>;
+    };
+}
+
+// `std::expected` has no null-value, but carries an error instead. Pipelines propagate that error unchanged along
+// their null path, as long as the results are able to carry it.
+template <typename T, typename E>
+    requires(!std::is_void_v<T>)
+struct gimo::traits<std::expected<T, E>>
+{
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr bool has_value(std::expected<T, E> const& expected) noexcept
+    {
+        return expected.has_value();
+    }
+
+    template <typename Self>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr decltype(auto) error(Self&& self) noexcept
+    {
+        return std::forward<Self>(self).error();
+    }
+
+    template <typename V>
+    using rebind_value = typename detail::rebind_expected<V, E>::type;
+
+    template <typename F>
+    using rebind_error = std::expected<T, F>;
+
+    template <typename Error>
+        requires std::constructible_from<E, Error&&>
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr std::expected<T, E> construct_from_error(Error&& error)
+    {
+        return std::expected<T, E>{std::unexpect, std::forward<Error>(error)};
+    }
+
+    // Constructs the result in place, like `std::expected::transform` does.
+    // Results, which are also constructible from an lvalue, would not use the conversion but a constructor-template.
+    template <typename Fn, typename... Args>
+        requires std::is_object_v<std::invoke_result_t<Fn, Args...>>
+              && std::constructible_from<std::invoke_result_t<Fn, Args...>, gimo::detail::deferred_invocation<Fn, Args...>>
+              && (!std::constructible_from<std::invoke_result_t<Fn, Args...>, gimo::detail::deferred_invocation<Fn, Args...>&>)
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr auto construct_from_invoke(Fn&& fn, Args&&... args)
+    {
+        using Result = std::invoke_result_t<Fn, Args...>;
+
+        return std::expected<Result, E>{
+            std::in_place,
+            gimo::detail::deferred_invocation<Fn, Args...>{GIMO_DETAIL_FORWARD(fn), GIMO_DETAIL_FORWARD(args)...}};
+    }
+};
+
+#endif
+
+#endif
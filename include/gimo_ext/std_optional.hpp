@@ -9,16 +9,42 @@
 #pragma once
 
 #include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/OptionalRef.hpp"
 
+#include <concepts>
 #include <optional>
+#include <type_traits>
 
 template <typename T>
 struct gimo::traits<std::optional<T>>
 {
     static constexpr auto null{std::nullopt};
 
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr bool has_value(std::optional<T> const& opt) noexcept
+    {
+        return opt.has_value();
+    }
+
     template <typename V>
-    using rebind_value =  std::optional<V>;
+    using rebind_value = detail::rebind_optional_t<V>;
+
+    // Constructs the result in place, like `std::optional::transform` does.
+    // Results, which are also constructible from an lvalue, would not use the conversion but a constructor-template.
+    template <typename Fn, typename... Args>
+        requires std::is_object_v<std::invoke_result_t<Fn, Args...>>
+              && std::constructible_from<std::invoke_result_t<Fn, Args...>, gimo::detail::deferred_invocation<Fn, Args...>>
+              && (!std::constructible_from<std::invoke_result_t<Fn, Args...>, gimo::detail::deferred_invocation<Fn, Args...>&>)
+    [[nodiscard]]
+    GIMO_DETAIL_FLATTEN static constexpr auto construct_from_invoke(Fn&& fn, Args&&... args)
+    {
+        using Result = std::invoke_result_t<Fn, Args...>;
+
+        return std::optional<Result>{
+            std::in_place,
+            gimo::detail::deferred_invocation<Fn, Args...>{GIMO_DETAIL_FORWARD(fn), GIMO_DETAIL_FORWARD(args)...}};
+    }
 };
 
 #endif
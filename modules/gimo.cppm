@@ -0,0 +1,56 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// Exports everything, which is reachable via the umbrella header `gimo.hpp`.
+// All std headers must be included in the global module fragment, as they must not be attached to this module.
+// The gimo entities themselves are declared within `extern "C++"`, so that they are attached to the global module,
+// which keeps them specializable (e.g. `gimo::traits`) and interchangeable with the header-only variant.
+//
+// Note: Macros do not cross module boundaries, thus all `GIMO_CONFIG_*` options must be set when building this module.
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+
+#if defined(GIMO_CONFIG_EXECUTION_POLICIES) && defined(__cpp_lib_execution)
+    #include <execution>
+#endif
+
+#if defined(GIMO_CONFIG_EXPERIMENTAL_SIMD) && __has_include(<experimental/simd>)
+    #include <experimental/simd>
+#endif
+
+export module gimo;
+
+export extern "C++"
+{
+#include "gimo.hpp"
+}
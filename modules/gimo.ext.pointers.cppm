@@ -0,0 +1,25 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// Exports the `gimo::traits` specializations for raw and smart pointers and re-exports the `gimo.ext.std_optional`
+// module, as pointers are rebound to `std::optional` for value results.
+
+module;
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include "gimo.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+export module gimo.ext.pointers;
+
+export import gimo.ext.std_optional;
+
+export extern "C++"
+{
+#include "gimo_ext/pointers.hpp"
+}
@@ -0,0 +1,28 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// Exports the `gimo::traits` specialization for `std::expected` and re-exports the `gimo` module.
+// If the standard library does not provide `std::expected`, this module merely re-exports the `gimo` module.
+
+module;
+
+#include <version>
+
+#ifdef __cpp_lib_expected
+    #include <concepts>
+    #include <expected>
+    #include <functional>
+#endif
+
+#include "gimo.hpp"
+
+export module gimo.ext.std_expected;
+
+export import gimo;
+
+export extern "C++"
+{
+#include "gimo_ext/std_expected.hpp"
+}
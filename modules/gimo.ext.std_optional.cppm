@@ -0,0 +1,37 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// Exports the `gimo::traits` specialization for `std::optional` and re-exports the `gimo` module.
+// `gimo::sentinel_optional` and `gimo::nullable_column` rely on that specialization, thus they are exported here, too.
+// The core headers are included in the global module fragment, so that their include-guards prevent them from being
+// included again into the purview. Their declarations are the very same as those of the imported `gimo` module.
+
+module;
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gimo.hpp"
+
+export module gimo.ext.std_optional;
+
+export import gimo;
+
+export extern "C++"
+{
+#include "gimo_ext/std_optional.hpp"
+
+#include "gimo/NullableColumn.hpp"
+#include "gimo/SentinelOptional.hpp"
+}
@@ -0,0 +1,136 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Batch.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <list>
+#include <ranges>
+#include <string>
+#include <vector>
+
+TEST_CASE(
+    "apply_batch applies the pipeline on each element of a span.",
+    "[batch]")
+{
+    std::vector<std::optional<int>> const inputs{1, std::nullopt, 3, std::nullopt, 5};
+    std::vector<std::optional<float>> outputs(inputs.size());
+
+    auto const pipeline = gimo::transform([](int const v) { return 1.5f * static_cast<float>(v); });
+    std::size_t const engaged = gimo::apply_batch(std::span{inputs}, std::span{outputs}, pipeline);
+
+    CHECK(3u == engaged);
+    CHECK_THAT(
+        outputs,
+        Catch::Matchers::RangeEquals(std::vector<std::optional<float>>{1.5f, std::nullopt, 4.5f, std::nullopt, 7.5f}));
+}
+
+TEST_CASE(
+    "apply_batch supports arbitrary ranges.",
+    "[batch]")
+{
+    std::list<std::optional<int>> const inputs{1, std::nullopt, 3, 4};
+    std::list<std::optional<int>> outputs(inputs.size());
+
+    std::size_t const engaged = gimo::apply_batch(
+        inputs,
+        outputs,
+        gimo::and_then([](int const v) { return v % 2 == 0 ? std::optional{v} : std::nullopt; }));
+
+    CHECK(1u == engaged);
+    CHECK_THAT(
+        outputs,
+        Catch::Matchers::RangeEquals(std::vector<std::optional<int>>{std::nullopt, std::nullopt, std::nullopt, 4}));
+}
+
+TEST_CASE(
+    "apply_batch does not move from the steps between elements.",
+    "[batch]")
+{
+    std::vector<std::optional<int>> const inputs{1, 2, 3};
+    std::vector<std::optional<std::size_t>> outputs(inputs.size());
+
+    std::vector<int> const offsets{1, 2, 3, 4};
+    auto action = [offsets](int const v) { return offsets.size() + static_cast<std::size_t>(v); };
+    std::size_t const engaged = gimo::apply_batch(inputs, outputs, gimo::transform(std::move(action)));
+
+    CHECK(3u == engaged);
+    CHECK_THAT(
+        outputs,
+        Catch::Matchers::RangeEquals(std::vector<std::optional<std::size_t>>{5u, 6u, 7u}));
+}
+
+TEST_CASE(
+    "compact writes only the engaged results densely into the outputs.",
+    "[batch][compact]")
+{
+    std::vector<std::optional<int>> const inputs{1, std::nullopt, 2, 3, std::nullopt, 4, 6};
+    std::vector<float> outputs(inputs.size(), -1.f);
+
+    auto const pipeline = gimo::and_then([](int const v) { return v % 2 == 0 ? std::optional{v} : std::nullopt; })
+                        | gimo::transform([](int const v) { return 0.5f * static_cast<float>(v); });
+    std::size_t const written = gimo::compact(std::span{inputs}, std::span{outputs}, pipeline);
+
+    REQUIRE(3u == written);
+    CHECK_THAT(
+        std::span{outputs}.first(written),
+        Catch::Matchers::RangeEquals(std::vector{1.f, 2.f, 3.f}));
+
+    // Elements beyond the written ones are left untouched.
+    CHECK_THAT(
+        std::span{outputs}.subspan(written),
+        Catch::Matchers::RangeEquals(std::vector{-1.f, -1.f, -1.f, -1.f}));
+}
+
+TEST_CASE(
+    "compact supports non-trivial values.",
+    "[batch][compact]")
+{
+    std::vector<std::optional<int>> const inputs{std::nullopt, 1, std::nullopt, 42};
+    std::vector<std::string> outputs(inputs.size());
+
+    std::size_t const written = gimo::compact(
+        inputs,
+        outputs,
+        gimo::transform([](int const v) { return std::to_string(v); }));
+
+    REQUIRE(2u == written);
+    CHECK_THAT(
+        std::span{outputs}.first(written),
+        Catch::Matchers::RangeEquals(std::vector<std::string>{"1", "42"}));
+}
+
+TEST_CASE(
+    "compact supports arbitrary ranges.",
+    "[batch][compact]")
+{
+    std::list<std::optional<int>> const inputs{1, std::nullopt, 3, 4};
+    std::list<int> outputs(inputs.size());
+
+    std::size_t const written = gimo::compact(
+        inputs,
+        outputs,
+        gimo::and_then([](int const v) { return v % 2 == 1 ? std::optional{v} : std::nullopt; }));
+
+    REQUIRE(2u == written);
+    CHECK_THAT(
+        outputs | std::views::take(written),
+        Catch::Matchers::RangeEquals(std::vector{1, 3}));
+}
+
+TEST_CASE(
+    "compact writes nothing, if all results are null.",
+    "[batch][compact]")
+{
+    std::vector<std::optional<int>> const inputs{std::nullopt, std::nullopt};
+    std::vector<int> outputs{};
+
+    CHECK(0u == gimo::compact(std::span{inputs}.first(0u), std::span{outputs}, gimo::transform([](int const v) { return v; })));
+
+    outputs.resize(inputs.size(), 1337);
+    CHECK(0u == gimo::compact(inputs, outputs, gimo::transform([](int const v) { return v; })));
+}
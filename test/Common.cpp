@@ -101,3 +101,89 @@ TEMPLATE_TEST_CASE_SIG(
 {
     STATIC_CHECK(expected == gimo::nullable<T>);
 }
+
+namespace
+{
+    struct FlaggedNull
+    {
+    };
+
+    struct Flagged
+    {
+        int payload{};
+        bool engaged{};
+
+        inline static mimicpp::Mock<bool() const> is_null{
+            {.name = "Flagged::is_null", .stacktraceSkip = 1u}
+        };
+
+        [[nodiscard]]
+        bool operator==([[maybe_unused]] FlaggedNull const null) const
+        {
+            return is_null();
+        }
+    };
+}
+
+template <>
+struct gimo::traits<Flagged>
+{
+    static constexpr FlaggedNull null{};
+
+    [[nodiscard]]
+    static constexpr bool has_value(Flagged const& flagged) noexcept
+    {
+        return flagged.engaged;
+    }
+
+    template <typename Self>
+    [[nodiscard]]
+    static constexpr auto&& value(Self&& self) noexcept
+    {
+        return detail::forward_like<Self>(self.payload);
+    }
+};
+
+TEST_CASE(
+    "Traits may customize the value access.",
+    "[customization]")
+{
+    STATIC_CHECK(gimo::detail::customized_value<Flagged&>);
+    STATIC_CHECK(gimo::detail::customized_value<Flagged const&&>);
+    STATIC_CHECK(!gimo::detail::customized_value<std::optional<int>&>);
+
+    Flagged flagged{.payload = 42, .engaged = true};
+    decltype(auto) ref = gimo::value(flagged);
+    STATIC_CHECK(std::same_as<int&, decltype(ref)>);
+    CHECK(&flagged.payload == &ref);
+
+    decltype(auto) constRValueRef = gimo::value(std::move(std::as_const(flagged)));
+    STATIC_CHECK(std::same_as<int const&&, decltype(constRValueRef)>);
+}
+
+TEST_CASE(
+    "Traits may customize the engagement test.",
+    "[customization]")
+{
+    STATIC_CHECK(gimo::detail::customized_has_value<Flagged>);
+    STATIC_CHECK(gimo::detail::customized_has_value<std::optional<int>>);
+
+    // The null-value is never compared with, as Flagged::is_null has no expectations.
+    SECTION("When the flag is set, the nullable is engaged.")
+    {
+        Flagged const flagged{.payload = 42, .engaged = true};
+        CHECK(gimo::detail::has_value(flagged));
+    }
+
+    SECTION("When the flag is not set, the nullable is null, regardless of its payload.")
+    {
+        Flagged const flagged{.payload = 42, .engaged = false};
+        CHECK(!gimo::detail::has_value(flagged));
+    }
+
+    SECTION("When default constructed, the nullable is null.")
+    {
+        Flagged const flagged{};
+        CHECK(!gimo::detail::has_value(flagged));
+    }
+}
@@ -0,0 +1,100 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// We disable assertions here on purpose so that they do not interfere with the counted null-tests.
+#define GIMO_ASSERT(condition, msg, ...) (void(0))
+
+#include "gimo/Engaged.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+namespace
+{
+    struct Counted
+    {
+        std::optional<int> value{};
+
+        [[nodiscard]]
+        friend bool operator==(Counted const&, Counted const&) = default;
+    };
+
+    int testCount{};
+}
+
+template <>
+struct gimo::traits<Counted>
+{
+    static constexpr Counted null{};
+
+    template <typename V>
+    using rebind_value = std::optional<V>;
+
+    [[nodiscard]]
+    static bool has_value(Counted const& nullable)
+    {
+        ++testCount;
+
+        return nullable.value.has_value();
+    }
+
+    template <typename Self>
+    [[nodiscard]]
+    static constexpr decltype(auto) value(Self&& self)
+    {
+        return *std::forward<Self>(self).value;
+    }
+};
+
+TEST_CASE(
+    "gimo::engaged is never part of the results.",
+    "[engaged]")
+{
+    auto const pipeline = gimo::and_then([](int const v) { return gimo::engaged{std::optional{v}}; })
+                        | gimo::or_else([] { return gimo::engaged{std::optional{42}}; });
+    STATIC_CHECK(std::same_as<std::optional<int>, decltype(pipeline.apply(std::optional<int>{}))>);
+
+    CHECK(std::optional{1337} == pipeline.apply(std::optional{1337}));
+    CHECK(std::optional{42} == pipeline.apply(std::optional<int>{}));
+    CHECK(std::optional{1337} == gimo::apply(gimo::engaged{std::optional{1337}}, pipeline));
+}
+
+TEST_CASE(
+    "Null-tests are skipped for engaged nullables.",
+    "[engaged][pipeline]")
+{
+    testCount = 0;
+
+    SECTION("When the pipeline is applied on gimo::engaged.")
+    {
+        auto const pipeline = gimo::transform([](int const v) { return 2 * v; });
+
+        CHECK(std::optional{42} == pipeline.apply(gimo::engaged{Counted{21}}));
+        CHECK(0 == testCount);
+    }
+
+    SECTION("When an and_then action returns gimo::engaged.")
+    {
+        auto const pipeline = gimo::and_then([](int const v) { return gimo::engaged{Counted{v + 1}}; })
+                            | gimo::and_then([](int const v) { return Counted{2 * v}; });
+
+        CHECK(Counted{42} == pipeline.apply(Counted{20}));
+        CHECK(1 == testCount);
+
+        testCount = 0;
+        CHECK(Counted{} == pipeline.apply(Counted{}));
+        CHECK(1 == testCount);
+    }
+
+    SECTION("When an or_else action returns gimo::engaged.")
+    {
+        auto const pipeline = gimo::or_else([] { return gimo::engaged{Counted{42}}; })
+                            | gimo::and_then([](int const v) { return Counted{v}; });
+
+        CHECK(Counted{42} == pipeline.apply(Counted{}));
+        CHECK(1 == testCount);
+    }
+}
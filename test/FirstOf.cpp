@@ -0,0 +1,181 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/FirstOf.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_expected.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <map>
+#include <optional>
+#include <string>
+
+namespace
+{
+    // An in-process stand-in for a single tier (e.g. a cache or a backend), which counts its lookups.
+    class Tier
+    {
+    public:
+        std::map<int, std::string> entries{};
+        int lookups{};
+
+        [[nodiscard]]
+        std::optional<std::string> lookup(int const key)
+        {
+            ++lookups;
+            if (auto const iter = entries.find(key);
+                iter != entries.cend())
+            {
+                return iter->second;
+            }
+
+            return std::nullopt;
+        }
+
+        [[nodiscard]]
+        auto source()
+        {
+            return [this](int const key) { return lookup(key); };
+        }
+
+        [[nodiscard]]
+        auto writable_source()
+        {
+            return gimo::with_write_back(
+                source(),
+                [this](int const key, std::string const& value) { entries.insert_or_assign(key, value); });
+        }
+    };
+}
+
+TEST_CASE(
+    "gimo::first_of queries the sources lazily.",
+    "[first_of]")
+{
+    Tier l1{};
+    Tier l2{.entries = {{2, "two"}}};
+    Tier backend{.entries = {{1, "one"}, {2, "backend-two"}, {3, "three"}}};
+    l1.entries = {{1, "cached-one"}};
+
+    auto const pipeline = gimo::first_of(l1.source(), l2.source(), backend.source())
+                        | gimo::transform([](std::string const& str) { return str.size(); });
+
+    SECTION("The first source stops the query, when it provides a value.")
+    {
+        CHECK(std::optional<std::size_t>{10u} == pipeline.apply(std::optional{1}));
+        CHECK(1 == l1.lookups);
+        CHECK(0 == l2.lookups);
+        CHECK(0 == backend.lookups);
+    }
+
+    SECTION("Later sources are queried, when the earlier ones do not provide a value.")
+    {
+        CHECK(std::optional<std::size_t>{3u} == pipeline.apply(std::optional{2}));
+        CHECK(1 == l1.lookups);
+        CHECK(1 == l2.lookups);
+        CHECK(0 == backend.lookups);
+
+        CHECK(std::optional<std::size_t>{5u} == pipeline.apply(std::optional{3}));
+        CHECK(2 == l1.lookups);
+        CHECK(2 == l2.lookups);
+        CHECK(1 == backend.lookups);
+    }
+
+    SECTION("The result is null, when no source provides a value.")
+    {
+        CHECK(std::nullopt == pipeline.apply(std::optional{4}));
+        CHECK(1 == backend.lookups);
+    }
+
+    SECTION("Null inputs do not query any source.")
+    {
+        CHECK(std::nullopt == pipeline.apply(std::optional<int>{}));
+        CHECK(0 == l1.lookups);
+    }
+}
+
+TEST_CASE(
+    "gimo::first_of writes the results back into the earlier sources.",
+    "[first_of]")
+{
+    Tier l1{};
+    Tier l2{};
+    Tier backend{.entries = {{1, "one"}}};
+
+    auto const pipeline = gimo::first_of(l1.writable_source(), l2.source(), backend.source());
+
+    CHECK(std::optional<std::string>{"one"} == pipeline.apply(std::optional{1}));
+    CHECK(1 == backend.lookups);
+
+    SECTION("Only writable sources receive the result.")
+    {
+        CHECK(l1.entries.contains(1));
+        CHECK(!l2.entries.contains(1));
+    }
+
+    SECTION("Subsequent queries are answered by the written source.")
+    {
+        CHECK(std::optional<std::string>{"one"} == pipeline.apply(std::optional{1}));
+        CHECK(2 == l1.lookups);
+        CHECK(1 == l2.lookups);
+        CHECK(1 == backend.lookups);
+    }
+
+    SECTION("Nulls are not written back.")
+    {
+        CHECK(std::nullopt == pipeline.apply(std::optional{2}));
+        CHECK(!l1.entries.contains(2));
+    }
+}
+
+TEST_CASE(
+    "gimo::first_of records which source provided the result.",
+    "[first_of]")
+{
+    Tier l1{.entries = {{1, "one"}}};
+    Tier backend{.entries = {{1, "one"}, {2, "two"}}};
+
+    gimo::source_stats stats{2u};
+    auto const pipeline = gimo::first_of(stats, l1.source(), backend.source());
+
+    CHECK(std::optional<std::string>{"one"} == pipeline.apply(std::optional{1}));
+    CHECK(std::optional<std::string>{"two"} == pipeline.apply(std::optional{2}));
+    CHECK(std::optional<std::string>{"two"} == pipeline.apply(std::optional{2}));
+    CHECK(std::nullopt == pipeline.apply(std::optional{3}));
+    CHECK(std::nullopt == pipeline.apply(std::optional<int>{}));
+
+    CHECK(2u == stats.source_count());
+    CHECK(1u == stats.hits(0u));
+    CHECK(2u == stats.hits(1u));
+    CHECK(1u == stats.misses());
+
+    SECTION("The stats can be reset.")
+    {
+        stats.reset();
+        CHECK(0u == stats.hits(0u));
+        CHECK(0u == stats.hits(1u));
+        CHECK(0u == stats.misses());
+    }
+}
+
+#ifdef __cpp_lib_expected
+
+TEST_CASE(
+    "gimo::first_of propagates the error of the last source.",
+    "[first_of]")
+{
+    using Expected = std::expected<int, std::string>;
+
+    auto const pipeline = gimo::first_of(
+        [](int const key) { return 0 == key % 2 ? Expected{key} : Expected{std::unexpect, "cache-miss"}; },
+        [](int const key) { return 0 == key % 3 ? Expected{key} : Expected{std::unexpect, "backend-miss"}; });
+
+    CHECK(Expected{2} == pipeline.apply(Expected{2}));
+    CHECK(Expected{3} == pipeline.apply(Expected{3}));
+    CHECK(Expected{std::unexpect, "backend-miss"} == pipeline.apply(Expected{5}));
+    CHECK(Expected{std::unexpect, "input"} == pipeline.apply(Expected{std::unexpect, "input"}));
+}
+
+#endif
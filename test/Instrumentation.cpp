@@ -0,0 +1,162 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// Instrumentation is opt-in, thus it is enabled for this translation unit only.
+#define GIMO_CONFIG_INSTRUMENTATION
+
+#include "gimo/Engaged.hpp"
+#include "gimo/Instrumentation.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr auto half = [](int const value) {
+        return 0 == value % 2 ? std::optional{value / 2} : std::nullopt;
+    };
+}
+
+TEST_CASE(
+    "gimo::instrument counts the taken paths of each step.",
+    "[instrumentation]")
+{
+    gimo::probe_registry registry{};
+    auto const pipeline = gimo::instrument(
+        registry,
+        "half",
+        gimo::and_then(half)
+            | gimo::and_then(half)
+            | gimo::or_else([] { return std::optional{-1}; }));
+
+    CHECK(std::optional{1} == pipeline.apply(std::optional{4}));
+    CHECK(std::optional{-1} == pipeline.apply(std::optional{2}));
+    CHECK(std::optional{-1} == pipeline.apply(std::optional{3}));
+    CHECK(std::optional{-1} == pipeline.apply(std::optional<int>{}));
+
+    std::vector const reports = registry.snapshot();
+    REQUIRE(1u == reports.size());
+    CHECK("half" == reports[0].name);
+    REQUIRE(3u == reports[0].steps.size());
+
+    CHECK(3u == reports[0].steps[0].value_count);
+    CHECK(1u == reports[0].steps[0].null_count);
+    CHECK(2u == reports[0].steps[1].value_count);
+    CHECK(2u == reports[0].steps[1].null_count);
+    CHECK(1u == reports[0].steps[2].value_count);
+    CHECK(3u == reports[0].steps[2].null_count);
+
+    SECTION("The counters can be reset.")
+    {
+        registry.reset();
+
+        std::vector const resetReports = registry.snapshot();
+        for (gimo::step_report const& step : resetReports[0].steps)
+        {
+            CHECK(0u == step.value_count);
+            CHECK(0u == step.null_count);
+        }
+    }
+}
+
+TEST_CASE(
+    "gimo::instrument counts known-engaged inputs on the value path.",
+    "[instrumentation]")
+{
+    gimo::probe_registry registry{};
+    auto const pipeline = gimo::instrument(registry, "engaged", gimo::transform([](int const v) { return v + 1; }));
+
+    CHECK(std::optional{43} == pipeline.apply(gimo::engaged{std::optional{42}}));
+
+    std::vector const reports = registry.snapshot();
+    CHECK(1u == reports[0].steps[0].value_count);
+    CHECK(0u == reports[0].steps[0].null_count);
+}
+
+TEST_CASE(
+    "gimo::instrument samples every n-th call of each step path.",
+    "[instrumentation]")
+{
+    gimo::probe_registry registry{4u};
+    auto const pipeline = gimo::instrument(registry, "sampled", gimo::transform([](int const v) { return v + 1; }));
+
+    for (int i{}; i < 10; ++i)
+    {
+        CHECK(std::optional{i + 1} == pipeline.apply(std::optional{i}));
+    }
+
+    std::vector const reports = registry.snapshot();
+    CHECK(10u == reports[0].steps[0].value_count);
+    CHECK(3u == reports[0].steps[0].sample_count);
+}
+
+TEST_CASE(
+    "gimo::instrument shares the recorded data of pipelines with the same name.",
+    "[instrumentation]")
+{
+    gimo::probe_registry registry{};
+    auto const pipeline = gimo::instrument(registry, "shared", gimo::and_then(half));
+
+    std::vector<std::thread> threads{};
+    for (int t{}; t < 4; ++t)
+    {
+        threads.emplace_back([&] {
+            auto const other = gimo::instrument(registry, "shared", gimo::and_then(half));
+            for (int i{}; i < 1000; ++i)
+            {
+                [[maybe_unused]] auto const result = other.apply(std::optional{i});
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(std::optional{21} == pipeline.apply(std::optional{42}));
+
+    std::vector const reports = registry.snapshot();
+    REQUIRE(1u == reports.size());
+    CHECK(4001u == reports[0].steps[0].value_count);
+}
+
+TEST_CASE(
+    "gimo::suggest_expectations derives the expectation of each step from its counters.",
+    "[instrumentation]")
+{
+    gimo::pipeline_report const report{
+        .name = "report",
+        .steps = {
+                  gimo::step_report{.value_count = 95u, .null_count = 5u},
+                  gimo::step_report{.value_count = 5u, .null_count = 95u},
+                  gimo::step_report{.value_count = 50u, .null_count = 50u},
+                  gimo::step_report{},
+                  gimo::step_report{.value_count = 0u, .null_count = 1u}}
+    };
+
+    CHECK(
+        std::vector{
+            gimo::expectation::value,
+            gimo::expectation::null,
+            gimo::expectation::none,
+            gimo::expectation::none,
+            gimo::expectation::null}
+        == gimo::suggest_expectations(report));
+
+    CHECK(
+        std::vector{
+            gimo::expectation::none,
+            gimo::expectation::none,
+            gimo::expectation::none,
+            gimo::expectation::none,
+            gimo::expectation::null}
+        == gimo::suggest_expectations(report, 0.99));
+}
@@ -0,0 +1,153 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Memoize.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE(
+    "gimo::memoize deduces the key from non-generic actions.",
+    "[memoize]")
+{
+    auto const fromValue = gimo::memoize([](int const v) { return v; }, 8u);
+    STATIC_CHECK(std::same_as<int, decltype(fromValue)::key_type>);
+
+    auto const fromRef = gimo::memoize([](std::string const& str) { return str.size(); }, 8u);
+    STATIC_CHECK(std::same_as<std::string, decltype(fromRef)::key_type>);
+
+    auto const explicitKey = gimo::memoize<long>([](auto const v) { return v; }, 8u);
+    STATIC_CHECK(std::same_as<long, decltype(explicitKey)::key_type>);
+}
+
+TEST_CASE(
+    "gimo::memoize invokes the action only once per key.",
+    "[memoize]")
+{
+    int invocations{};
+    auto const lookup = gimo::memoize(
+        [&](int const v) {
+            ++invocations;
+
+            return 0 < v ? std::optional{std::to_string(v)} : std::nullopt;
+        },
+        64u);
+    auto const pipeline = gimo::and_then(lookup)
+                        | gimo::transform([](std::string const& str) { return str.size(); });
+
+    CHECK(std::optional<std::size_t>{2u} == pipeline.apply(std::optional{42}));
+    CHECK(std::optional<std::size_t>{2u} == pipeline.apply(std::optional{42}));
+    CHECK(1 == invocations);
+
+    SECTION("Null results are cached, too.")
+    {
+        CHECK(std::nullopt == pipeline.apply(std::optional{-1}));
+        CHECK(std::nullopt == pipeline.apply(std::optional{-1}));
+        CHECK(2 == invocations);
+    }
+
+    SECTION("Null inputs do not reach the cache.")
+    {
+        CHECK(std::nullopt == pipeline.apply(std::optional<int>{}));
+        CHECK(1 == invocations);
+    }
+
+    SECTION("All copies share the cache and the stats.")
+    {
+        gimo::memo_stats const stats = lookup.stats();
+        CHECK(1u == stats.hits);
+        CHECK(1u == stats.misses);
+    }
+
+    SECTION("The cache can be cleared.")
+    {
+        lookup.clear();
+        CHECK(0u == lookup.stats().hits);
+        CHECK(0u == lookup.stats().misses);
+
+        CHECK(std::optional<std::size_t>{2u} == pipeline.apply(std::optional{42}));
+        CHECK(2 == invocations);
+    }
+}
+
+TEST_CASE(
+    "gimo::memoize has a fixed capacity.",
+    "[memoize]")
+{
+    int invocations{};
+    auto const square = gimo::memoize(
+        [&](int const v) {
+            ++invocations;
+
+            return v * v;
+        },
+        64u);
+    REQUIRE(64u <= square.capacity());
+
+    for (int i{}; i < 10'000; ++i)
+    {
+        CHECK(i * i == square(i));
+    }
+    CHECK(10'000 == invocations);
+
+    // Results are never wrong, even if they have been overwritten in between.
+    for (int i{}; i < 10'000; ++i)
+    {
+        CHECK(i * i == square(i));
+    }
+
+    int const hits = 20'000 - invocations;
+    CHECK(hits <= static_cast<int>(square.capacity()));
+    CHECK(static_cast<std::uint64_t>(hits) == square.stats().hits);
+}
+
+TEST_CASE(
+    "gimo::memoize is usable concurrently.",
+    "[memoize]")
+{
+    std::atomic_int invocations{};
+    auto const square = gimo::memoize(
+        [&](int const v) {
+            ++invocations;
+
+            return v * v;
+        },
+        1024u);
+
+    std::atomic_int failures{};
+    std::vector<std::thread> threads{};
+    for (int t{}; t < 4; ++t)
+    {
+        threads.emplace_back([&] {
+            for (int round{}; round < 10; ++round)
+            {
+                for (int i{}; i < 256; ++i)
+                {
+                    if (i * i != square(i))
+                    {
+                        ++failures;
+                    }
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(0 == failures);
+
+    gimo::memo_stats const stats = square.stats();
+    CHECK(4u * 10u * 256u == stats.hits + stats.misses);
+    CHECK(stats.misses == static_cast<std::uint64_t>(invocations.load()));
+}
@@ -0,0 +1,194 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/NullableColumn.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+using Column = gimo::nullable_column<int>;
+
+TEMPLATE_TEST_CASE(
+    "nullable_column elements satisfy gimo::nullable.",
+    "[nullable_column][concept]",
+    Column::reference,
+    Column::reference const&,
+    Column::reference&&,
+    Column::const_reference,
+    Column::const_reference const&,
+    Column::const_reference&&)
+{
+    STATIC_CHECK(gimo::nullable<TestType>);
+}
+
+TEST_CASE(
+    "nullable_column tracks the engagement in a packed bitmap.",
+    "[nullable_column]")
+{
+    Column column{};
+    for (int i = 0; i < 130; ++i)
+    {
+        if (0 == i % 3)
+        {
+            column.push_back(i);
+        }
+        else
+        {
+            column.push_back(std::nullopt);
+        }
+    }
+
+    REQUIRE(130u == column.size());
+    CHECK(3u == column.validity().size());
+    CHECK(44u == column.count_valid());
+    CHECK(column.is_valid(0u));
+    CHECK(!column.is_valid(1u));
+    CHECK(column.is_valid(129u));
+
+    SECTION("Elements can be reset.")
+    {
+        column.reset(129u);
+        CHECK(!column.is_valid(129u));
+        CHECK(43u == column.count_valid());
+    }
+
+    SECTION("Elements can be set.")
+    {
+        column.set(128u, 42);
+        CHECK(column.is_valid(128u));
+        CHECK(42 == *column[128u]);
+        CHECK(45u == column.count_valid());
+    }
+
+    SECTION("Shrinking discards the engagement of removed elements.")
+    {
+        column.resize(4u);
+        CHECK(1u == column.validity().size());
+        CHECK(2u == column.count_valid());
+
+        column.resize(130u);
+        CHECK(2u == column.count_valid());
+    }
+}
+
+TEST_CASE(
+    "nullable_column elements refer to the column.",
+    "[nullable_column]")
+{
+    Column column{42, std::nullopt};
+
+    Column::reference element = column[0u];
+    CHECK(element.has_value());
+    CHECK(&column.values()[0u] == &*element);
+    CHECK(!column[1u].has_value());
+    CHECK(std::nullopt == column[1u]);
+
+    SECTION("Assigning null to an element does not alter the column.")
+    {
+        element = std::nullopt;
+        CHECK(!element.has_value());
+        CHECK(column.is_valid(0u));
+    }
+
+    SECTION("Mutable elements are convertible to const elements.")
+    {
+        Column::const_reference const constElement = element;
+        CHECK(&column.values()[0u] == &*constElement);
+    }
+}
+
+TEST_CASE(
+    "Pipelines can be applied on nullable_column elements.",
+    "[nullable_column][pipeline]")
+{
+    Column const column{42, std::nullopt};
+    auto const pipeline = gimo::transform([](int const v) { return static_cast<float>(v) + 0.5f; })
+                        | gimo::and_then([](float const v) { return std::optional{2.f * v}; })
+                        | gimo::or_else([] { return std::optional{-1.f}; });
+
+    CHECK(std::optional{85.f} == pipeline.apply(column[0u]));
+    CHECK(std::optional{-1.f} == pipeline.apply(column[1u]));
+}
+
+TEST_CASE(
+    "apply_batch processes a nullable_column word-wise.",
+    "[nullable_column][batch]")
+{
+    Column column(200u);
+    column.set(3u, 3);
+    column.set(150u, 150);
+    column.set(199u, 199);
+
+    SECTION("Null-preserving pipelines skip null elements.")
+    {
+        int calls{};
+        auto pipeline = gimo::transform([&](int const v) { ++calls; return v + 1; });
+        STATIC_REQUIRE(gimo::null_preserving_pipeline<decltype(pipeline)>);
+
+        gimo::nullable_column<int> result{};
+        CHECK(3u == gimo::apply_batch(column, result, pipeline));
+        CHECK(3 == calls);
+        REQUIRE(200u == result.size());
+        CHECK(3u == result.count_valid());
+        CHECK(4 == *result[3u]);
+        CHECK(151 == *result[150u]);
+        CHECK(200 == *result[199u]);
+    }
+
+    SECTION("Other pipelines are applied on null elements, too.")
+    {
+        auto pipeline = gimo::transform([](int const v) { return static_cast<float>(v); })
+                      | gimo::or_else([] { return std::optional{-1.f}; });
+        STATIC_REQUIRE(!gimo::null_preserving_pipeline<decltype(pipeline)>);
+
+        gimo::nullable_column<float> result{};
+        CHECK(200u == gimo::apply_batch(column, result, pipeline));
+        CHECK(200u == result.count_valid());
+        CHECK(-1.f == *result[0u]);
+        CHECK(150.f == *result[150u]);
+    }
+
+    SECTION("The input column may be used as output.")
+    {
+        CHECK(3u == gimo::apply_batch(column, column, gimo::transform([](int const v) { return 2 * v; })));
+        CHECK(6 == *column[3u]);
+        CHECK(300 == *column[150u]);
+        CHECK(!column.is_valid(4u));
+    }
+}
+
+TEST_CASE(
+    "apply_batch invokes pure transforms on every value of a nullable_column.",
+    "[nullable_column][batch][pure]")
+{
+    gimo::nullable_column<float> column(100u);
+    column.set(3u, 3.f);
+    column.set(70u, 70.f);
+
+    auto const pipeline = gimo::transform(gimo::pure([](auto const v) { return 2.f * v; }))
+                        | gimo::transform(gimo::pure([](auto const v) { return v + 1.f; }));
+    STATIC_REQUIRE(gimo::detail::is_unconditionally_transformable<std::remove_const_t<decltype(pipeline)>, float, float>::value);
+
+    SECTION("When a different column is used as output.")
+    {
+        gimo::nullable_column<float> result{};
+        CHECK(2u == gimo::apply_batch(column, result, pipeline));
+        REQUIRE(100u == result.size());
+        CHECK(2u == result.count_valid());
+        CHECK(7.f == *result[3u]);
+        CHECK(141.f == *result[70u]);
+        CHECK(std::nullopt == result[4u]);
+    }
+
+    SECTION("When the input column is used as output.")
+    {
+        CHECK(2u == gimo::apply_batch(column, column, pipeline));
+        REQUIRE(100u == column.size());
+        CHECK(2u == column.count_valid());
+        CHECK(7.f == *column[3u]);
+        CHECK(141.f == *column[70u]);
+        CHECK(std::nullopt == column[4u]);
+    }
+}
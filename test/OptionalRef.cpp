@@ -0,0 +1,120 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/OptionalRef.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+namespace
+{
+    struct CopyCounter
+    {
+        inline static int copies{};
+
+        CopyCounter() = default;
+
+        CopyCounter(CopyCounter const&)
+        {
+            ++copies;
+        }
+
+        CopyCounter& operator=(CopyCounter const&)
+        {
+            ++copies;
+
+            return *this;
+        }
+    };
+
+    struct Inner
+    {
+        CopyCounter payload{};
+        int id{42};
+    };
+
+    struct Outer
+    {
+        Inner inner{};
+    };
+}
+
+TEMPLATE_TEST_CASE(
+    "optional_ref satisfies gimo::nullable.",
+    "[optional_ref][concept]",
+    gimo::optional_ref<int>,
+    gimo::optional_ref<int> const,
+    gimo::optional_ref<int>&,
+    gimo::optional_ref<int const>&,
+    gimo::optional_ref<int const> const&,
+    gimo::optional_ref<int>&&)
+{
+    STATIC_CHECK(gimo::nullable<TestType>);
+}
+
+TEST_CASE(
+    "optional_ref refers to an object or to nothing.",
+    "[optional_ref]")
+{
+    SECTION("When default constructed.")
+    {
+        constexpr gimo::optional_ref<int> opt{};
+        STATIC_CHECK(!opt.has_value());
+        STATIC_CHECK(std::nullopt == opt);
+    }
+
+    SECTION("When constructed from an object.")
+    {
+        int value{42};
+        gimo::optional_ref const opt{value};
+        CHECK(opt.has_value());
+        CHECK(&value == &*opt);
+
+        gimo::optional_ref<int const> const constOpt{opt};
+        CHECK(&value == &*constOpt);
+    }
+
+    SECTION("When reset.")
+    {
+        int value{42};
+        gimo::optional_ref opt{value};
+        opt = std::nullopt;
+        CHECK(!opt.has_value());
+        CHECK(1337 == opt.value_or(1337));
+    }
+
+    STATIC_CHECK(!std::constructible_from<gimo::optional_ref<int const>, int&&>);
+}
+
+TEST_CASE(
+    "transform rebinds lvalue-reference results without copying the referred object.",
+    "[optional_ref][algorithm]")
+{
+    CopyCounter::copies = 0;
+    std::optional<Outer> outer{std::in_place};
+
+    SECTION("When all steps are transforms.")
+    {
+        auto const pipeline = gimo::transform([](Outer const& o) -> Inner const& { return o.inner; })
+                            | gimo::transform([](Inner const& i) -> CopyCounter const& { return i.payload; });
+
+        decltype(auto) result = pipeline.apply(outer);
+        STATIC_REQUIRE(std::same_as<gimo::detail::rebind_optional_t<CopyCounter const&>, decltype(result)>);
+        CHECK(&outer->inner.payload == &*result);
+        CHECK(0 == CopyCounter::copies);
+
+        CHECK(!pipeline.apply(std::optional<Outer>{}).has_value());
+    }
+
+    SECTION("When other steps are in between.")
+    {
+        auto const pipeline = gimo::transform([](Outer& o) -> Inner& { return o.inner; })
+                            | gimo::and_then([](Inner& i) { return 0 < i.id ? gimo::optional_ref{i} : std::nullopt; })
+                            | gimo::transform([](Inner const& i) { return i.id; });
+
+        CHECK(std::optional{42} == pipeline.apply(outer));
+        CHECK(0 == CopyCounter::copies);
+    }
+}
@@ -0,0 +1,123 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Parallel.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE(
+    "thread_pool::bulk invokes the function exactly once for each index.",
+    "[parallel]")
+{
+    std::size_t const concurrency = GENERATE(1u, 2u, 3u, 8u);
+    std::size_t const count = GENERATE(0u, 1u, 7u, 1000u);
+
+    gimo::thread_pool pool{concurrency};
+    CHECK(concurrency == pool.concurrency());
+
+    std::vector<std::atomic<int>> calls(count);
+    pool.bulk(count, [&](std::size_t const index) { ++calls[index]; });
+
+    for (std::atomic<int> const& c : calls)
+    {
+        CHECK(1 == c.load());
+    }
+}
+
+TEST_CASE(
+    "thread_pool can execute multiple bulk jobs successively.",
+    "[parallel]")
+{
+    gimo::thread_pool pool{4u};
+
+    std::atomic<std::size_t> sum{};
+    for (std::size_t i = 0u; i < 10u; ++i)
+    {
+        pool.bulk(100u, [&](std::size_t const index) { sum += index; });
+    }
+
+    CHECK(10u * 4950u == sum.load());
+}
+
+TEST_CASE(
+    "thread_pool::bulk rethrows an exception thrown by the function.",
+    "[parallel]")
+{
+    gimo::thread_pool pool{GENERATE(1u, 4u)};
+
+    std::atomic<std::size_t> calls{};
+    CHECK_THROWS_AS(
+        pool.bulk(
+            100u,
+            [&](std::size_t const index) {
+                ++calls;
+                if (42u == index)
+                {
+                    throw std::runtime_error{"Test"};
+                }
+            }),
+        std::runtime_error);
+    CHECK(100u == calls.load());
+
+    SECTION("And stays usable afterwards.")
+    {
+        calls = 0u;
+        pool.bulk(10u, [&](std::size_t) { ++calls; });
+        CHECK(10u == calls.load());
+    }
+}
+
+TEST_CASE(
+    "parallel_apply applies the pipeline on each element and preserves the order.",
+    "[parallel]")
+{
+    gimo::thread_pool pool{GENERATE(1u, 2u, 5u)};
+
+    std::vector<std::optional<int>> inputs(100'000u);
+    std::vector<std::optional<int>> expected(inputs.size());
+    for (std::size_t i = 0u; i < inputs.size(); ++i)
+    {
+        if (0u != i % 3u)
+        {
+            inputs[i] = static_cast<int>(i);
+        }
+    }
+
+    auto const pipeline = gimo::and_then([](int const v) { return 0 == v % 2 ? std::optional{v} : std::nullopt; })
+                        | gimo::transform([](int const v) { return v / 2; });
+    std::size_t const expectedEngaged = gimo::apply_batch(inputs, expected, pipeline);
+
+    SECTION("When outputs are provided.")
+    {
+        std::vector<std::optional<int>> outputs(inputs.size());
+        std::size_t const engaged = gimo::parallel_apply(inputs, outputs, pipeline, pool);
+
+        CHECK(expectedEngaged == engaged);
+        CHECK(expected == outputs);
+    }
+
+    SECTION("When outputs are returned.")
+    {
+        std::vector<std::optional<int>> const outputs = gimo::parallel_apply(inputs, pipeline, pool);
+
+        CHECK(expected == outputs);
+    }
+}
+
+TEST_CASE(
+    "parallel_apply does nothing for empty inputs.",
+    "[parallel]")
+{
+    gimo::thread_pool pool{2u};
+    std::vector<std::optional<int>> const inputs{};
+    std::vector<std::optional<int>> outputs{};
+
+    CHECK(0u == gimo::parallel_apply(inputs, outputs, gimo::transform([](int const v) { return v; }), pool));
+}
@@ -4,6 +4,9 @@
 //          https://www.boost.org/LICENSE_1_0.txt)
 
 #include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
 
 namespace
 {
@@ -139,3 +142,219 @@ TEST_CASE(
         }
     }
 }
+
+TEST_CASE(
+    "null_preserving_pipeline determines whether null inputs always result in null.",
+    "[pipeline][concept]")
+{
+    auto const toOpt = [](int const v) { return std::optional{v}; };
+    auto const identity = [](int const v) { return v; };
+    auto const fallback = [] { return std::optional{42}; };
+
+    STATIC_CHECK(gimo::null_preserving_pipeline<decltype(gimo::and_then(toOpt))>);
+    STATIC_CHECK(gimo::null_preserving_pipeline<decltype(gimo::transform(identity))>);
+    STATIC_CHECK(gimo::null_preserving_pipeline<decltype(gimo::and_then(toOpt) | gimo::transform(identity))&>);
+    STATIC_CHECK(!gimo::null_preserving_pipeline<decltype(gimo::or_else(fallback))>);
+    STATIC_CHECK(!gimo::null_preserving_pipeline<decltype(gimo::and_then(toOpt) | gimo::or_else(fallback))>);
+    STATIC_CHECK(!gimo::null_preserving_pipeline<std::optional<int>>);
+}
+
+TEST_CASE(
+    "gimo::pipe concatenates all steps into a single pipeline.",
+    "[pipeline]")
+{
+    auto const toOpt = [](int const v) { return 0 < v ? std::optional{v} : std::nullopt; };
+    auto const twice = [](int const v) { return 2 * v; };
+    auto const fallback = [] { return std::optional{42}; };
+
+    auto const pipeline = gimo::pipe(
+        gimo::and_then(toOpt),
+        gimo::transform(twice) | gimo::or_else(fallback),
+        gimo::transform(twice));
+
+    using Expected = gimo::Pipeline<
+        gimo::detail::and_then_t<decltype(toOpt)>,
+        gimo::detail::transform_t<decltype(twice)>,
+        gimo::detail::or_else_t<decltype(fallback)>,
+        gimo::detail::transform_t<decltype(twice)>>;
+    STATIC_CHECK(std::same_as<Expected const, decltype(pipeline)>);
+
+    CHECK(std::optional{84} == pipeline.apply(std::optional{21}));
+    CHECK(std::optional{84} == pipeline.apply(std::optional{-1}));
+    CHECK(std::optional{84} == gimo::apply(std::optional<int>{}, pipeline));
+}
+
+TEST_CASE(
+    "gimo::pipe fuses adjacent steps of different pipelines like operator|.",
+    "[pipeline]")
+{
+    auto const toOpt = [](int const v) { return 0 < v ? std::optional{v} : std::nullopt; };
+    auto const twice = [](int const v) { return 2 * v; };
+    auto const increment = [](int const v) { return v + 1; };
+    auto const fallback = [] { return std::optional{42}; };
+
+    auto const pipeline = gimo::pipe(
+        gimo::transform(twice),
+        gimo::transform(increment),
+        gimo::transform(twice) | gimo::or_else(fallback),
+        gimo::transform(increment),
+        gimo::and_then(toOpt));
+
+    auto const chained = gimo::transform(twice)
+                       | gimo::transform(increment)
+                       | (gimo::transform(twice) | gimo::or_else(fallback))
+                       | gimo::transform(increment)
+                       | gimo::and_then(toOpt);
+    STATIC_CHECK(std::same_as<decltype(chained), decltype(pipeline)>);
+
+    constexpr auto stepCount = []<typename... Steps>([[maybe_unused]] std::type_identity<gimo::Pipeline<Steps...>> const type) {
+        return sizeof...(Steps);
+    };
+    STATIC_CHECK(4u == stepCount(std::type_identity<std::remove_const_t<decltype(pipeline)>>{}));
+
+    CHECK(std::optional{11} == pipeline.apply(std::optional{2}));
+    CHECK(std::optional{43} == pipeline.apply(std::optional<int>{}));
+}
+
+TEST_CASE(
+    "gimo::pipe behaves like chained operator|.",
+    "[pipeline]")
+{
+    mimicpp::Mock<NullableMock<int>(float)> action1{};
+    mimicpp::Mock<NullableMock<bool>(int)> action2{};
+
+    NullableMock<float> nullable{};
+    auto pipeline = gimo::pipe(
+        gimo::and_then(std::ref(action1)),
+        gimo::and_then(std::ref(action2)));
+
+    mimicpp::ScopedSequence sequence{};
+    SECTION("When the nullable is null.")
+    {
+        sequence += NullableMock<float>::is_null.expect_call()
+                and finally::returns(true);
+
+        decltype(auto) result = pipeline.apply(nullable);
+        STATIC_CHECK(std::same_as<NullableMock<bool>, decltype(result)>);
+    }
+
+    SECTION("When nullable is not empty.")
+    {
+        sequence += NullableMock<float>::is_null.expect_call()
+                and finally::returns(false);
+        sequence += NullableMock<float>::value.expect_call()
+                and finally::returns(42.f);
+        sequence += action1.expect_call(42.f)
+                and finally::returns_result_of([] { return NullableMock<int>{}; });
+        sequence += NullableMock<int>::is_null.expect_call()
+                and finally::returns(false);
+        sequence += std::move(NullableMock<int>::value).expect_call()
+                and finally::returns(1337);
+        sequence += action2.expect_call(1337)
+                and finally::returns_result_of([] { return NullableMock<bool>{}; });
+
+        decltype(auto) result = std::move(pipeline).apply(nullable);
+        STATIC_CHECK(std::same_as<NullableMock<bool>, decltype(result)>);
+    }
+}
+
+TEST_CASE(
+    "gimo::expect_value and gimo::expect_null do not change the results of a pipeline.",
+    "[pipeline]")
+{
+    auto const toOpt = [](int const v) { return 0 < v ? std::optional{v} : std::nullopt; };
+    auto const twice = [](int const v) { return 2 * v; };
+    auto const fallback = [] { return std::optional{42}; };
+
+    SECTION("When the pipeline is null-preserving.")
+    {
+        auto const check = [](auto const& hinted) {
+            STATIC_CHECK(gimo::null_preserving_pipeline<decltype(hinted)>);
+
+            CHECK(std::optional{42} == hinted.apply(std::optional{21}));
+            CHECK(std::optional<int>{} == hinted.apply(std::optional{-1}));
+            CHECK(std::optional<int>{} == gimo::apply(std::optional<int>{}, hinted));
+        };
+
+        auto const pipeline = gimo::and_then(toOpt) | gimo::transform(twice);
+        check(gimo::expect_value(pipeline));
+        check(gimo::expect_null(pipeline));
+        check(gimo::expect_steps<gimo::expectation::value, gimo::expectation::null>(pipeline));
+        check(gimo::expect_steps<gimo::expectation::none, gimo::expectation::value>(pipeline));
+    }
+
+    SECTION("When the pipeline contains an or_else step.")
+    {
+        auto const check = [](auto const& hinted) {
+            STATIC_CHECK(gimo::applicable_pipeline<decltype(hinted)>);
+            STATIC_CHECK(!gimo::null_preserving_pipeline<decltype(hinted)>);
+
+            CHECK(std::optional{42} == hinted.apply(std::optional{21}));
+            CHECK(std::optional{84} == hinted.apply(std::optional{-1}));
+            CHECK(std::optional{84} == gimo::apply(std::optional<int>{}, hinted));
+        };
+
+        auto const pipeline = gimo::and_then(toOpt) | gimo::or_else(fallback) | gimo::transform(twice);
+        check(gimo::expect_value(pipeline));
+        check(gimo::expect_null(pipeline));
+        check(gimo::expect_steps<gimo::expectation::value, gimo::expectation::null, gimo::expectation::value>(pipeline));
+        check(gimo::expect_steps<gimo::expectation::null, gimo::expectation::none, gimo::expectation::null>(pipeline));
+    }
+}
+
+TEST_CASE(
+    "gimo::expect_value is usable in constant evaluation.",
+    "[pipeline]")
+{
+    constexpr auto pipeline = gimo::expect_value(
+        gimo::transform([](int const v) { return 2 * v; })
+        | gimo::or_else([] { return std::optional{42}; }));
+
+    STATIC_CHECK(std::optional{42} == pipeline.apply(std::optional{21}));
+    STATIC_CHECK(std::optional{42} == pipeline.apply(std::optional<int>{}));
+}
+
+TEST_CASE(
+    "gimo::expect_steps is usable in constant evaluation.",
+    "[pipeline]")
+{
+    constexpr auto pipeline = gimo::expect_steps<gimo::expectation::null, gimo::expectation::value>(
+        gimo::transform([](int const v) { return 2 * v; })
+        | gimo::or_else([] { return std::optional{42}; }));
+
+    STATIC_CHECK(std::optional{42} == pipeline.apply(std::optional{21}));
+    STATIC_CHECK(std::optional{42} == pipeline.apply(std::optional<int>{}));
+}
+
+namespace
+{
+    template <typename... Pipelines>
+    concept pipeable = requires(Pipelines&&... pipelines) {
+        gimo::pipe(std::forward<Pipelines>(pipelines)...);
+    };
+
+    template <typename Prefix, typename Suffix>
+    concept composable = requires(Prefix&& prefix, Suffix&& suffix) {
+        std::forward<Prefix>(prefix) | std::forward<Suffix>(suffix);
+    };
+}
+
+TEST_CASE(
+    "Pipelines with expectations can not be composed any further.",
+    "[pipeline][concept]")
+{
+    using Pipeline = decltype(gimo::transform([](int const v) { return 2 * v; }));
+    using Hinted = decltype(gimo::expect_value(std::declval<Pipeline>()));
+
+    STATIC_CHECK(gimo::applicable_pipeline<Hinted>);
+    STATIC_CHECK(!gimo::pipeline<Hinted>);
+
+    STATIC_CHECK(pipeable<Pipeline, Pipeline>);
+    STATIC_CHECK(!pipeable<Hinted>);
+    STATIC_CHECK(!pipeable<Hinted, Pipeline>);
+    STATIC_CHECK(!pipeable<Pipeline, Hinted const&>);
+
+    STATIC_CHECK(composable<Pipeline, Pipeline>);
+    STATIC_CHECK(!composable<Hinted, Pipeline>);
+    STATIC_CHECK(!composable<Pipeline, Hinted const&>);
+}
@@ -0,0 +1,116 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/pointers.hpp"
+
+#include <memory>
+#include <string>
+
+namespace
+{
+    struct Record
+    {
+        std::string name{"gimo"};
+        int id{42};
+    };
+}
+
+TEMPLATE_TEST_CASE(
+    "Pointers satisfy gimo::nullable.",
+    "[pointers][concept]",
+    Record*,
+    Record const*,
+    Record* const&,
+    std::unique_ptr<Record>,
+    std::unique_ptr<Record> const&,
+    std::unique_ptr<Record>&&,
+    std::shared_ptr<Record>,
+    std::shared_ptr<Record const> const&,
+    std::shared_ptr<Record>&&)
+{
+    STATIC_CHECK(gimo::nullable<TestType>);
+}
+
+TEST_CASE(
+    "Pointers are rebound to std::optional for value results.",
+    "[pointers][algorithm]")
+{
+    auto const pipeline = gimo::transform([](Record const& r) { return r.id; });
+
+    Record record{};
+    CHECK(std::optional{42} == pipeline.apply(&record));
+    CHECK(std::optional{42} == pipeline.apply(std::make_unique<Record>()));
+    CHECK(std::optional{42} == pipeline.apply(std::make_shared<Record>()));
+
+    CHECK(std::nullopt == pipeline.apply(static_cast<Record*>(nullptr)));
+    CHECK(std::nullopt == pipeline.apply(std::unique_ptr<Record>{}));
+    CHECK(std::nullopt == pipeline.apply(std::shared_ptr<Record>{}));
+}
+
+TEST_CASE(
+    "Raw and unique pointers are rebound to raw pointers for reference results.",
+    "[pointers][algorithm]")
+{
+    auto const pipeline = gimo::transform([](Record const& r) -> std::string const& { return r.name; });
+
+    SECTION("When applied on a raw pointer.")
+    {
+        Record record{};
+        decltype(auto) result = pipeline.apply(&record);
+        STATIC_REQUIRE(std::same_as<std::string const*, decltype(result)>);
+        CHECK(&record.name == result);
+
+        CHECK(nullptr == pipeline.apply(static_cast<Record*>(nullptr)));
+    }
+
+    SECTION("When applied on a unique_ptr.")
+    {
+        auto const record = std::make_unique<Record>();
+        decltype(auto) result = pipeline.apply(record);
+        STATIC_REQUIRE(std::same_as<std::string const*, decltype(result)>);
+        CHECK(&record->name == result);
+
+        CHECK(nullptr == pipeline.apply(std::unique_ptr<Record>{}));
+    }
+}
+
+TEST_CASE(
+    "shared_ptr is rebound to an aliasing shared_ptr for reference results.",
+    "[pointers][algorithm]")
+{
+    auto const pipeline = gimo::transform([](Record& r) -> std::string& { return r.name; })
+                        | gimo::transform([](std::string& name) -> char& { return name.front(); });
+
+    auto record = std::make_shared<Record>();
+
+    decltype(auto) result = pipeline.apply(record);
+    STATIC_REQUIRE(std::same_as<std::shared_ptr<char>, decltype(result)>);
+    CHECK(&record->name.front() == result.get());
+    CHECK(2 == record.use_count());
+
+    std::weak_ptr<Record> const weak{record};
+    record.reset();
+    CHECK(!weak.expired());
+    CHECK('g' == *result);
+
+    CHECK(nullptr == pipeline.apply(std::shared_ptr<Record>{}));
+}
+
+TEST_CASE(
+    "Pointers can be mixed with other nullables.",
+    "[pointers][algorithm]")
+{
+    Record record{};
+    auto const pipeline = gimo::and_then([&](int const id) { return id == record.id ? &record : nullptr; })
+                        | gimo::or_else([&] { return &record; })
+                        | gimo::transform([](Record const& r) -> std::string const& { return r.name; });
+
+    CHECK(&record.name == pipeline.apply(std::optional{42}));
+    CHECK(&record.name == pipeline.apply(std::optional{1337}));
+    CHECK(&record.name == pipeline.apply(std::optional<int>{}));
+}
@@ -0,0 +1,80 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Pure.hpp"
+#include "gimo/Simd.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <array>
+
+TEST_CASE(
+    "gimo::pure marks actions as pure.",
+    "[pure]")
+{
+    auto const action = [](int const v) { return v + 1; };
+
+    STATIC_CHECK(!gimo::pure_action<decltype(action)>);
+    STATIC_CHECK(gimo::pure_action<decltype(gimo::pure(action))>);
+    STATIC_CHECK(gimo::pure_action<decltype(gimo::pure(action)) const&>);
+
+    CHECK(43 == gimo::pure(action)(42));
+}
+
+TEST_CASE(
+    "Fused transforms are pure, if all of their actions are.",
+    "[pure][algorithm]")
+{
+    using gimo::detail::transform::composition;
+
+    auto const action = [](int const v) { return v + 1; };
+    using Pure = decltype(gimo::pure(action));
+    using Impure = std::remove_const_t<decltype(action)>;
+
+    STATIC_CHECK(gimo::pure_action<composition<Pure, Pure>>);
+    STATIC_CHECK(gimo::pure_action<composition<composition<Pure, Pure>, Pure>>);
+    STATIC_CHECK(!gimo::pure_action<composition<Pure, Impure>>);
+    STATIC_CHECK(!gimo::pure_action<composition<Impure, Pure>>);
+    STATIC_CHECK(!gimo::pure_action<composition<composition<Pure, Impure>, Pure>>);
+
+    auto const pipeline = gimo::transform(gimo::pure(action))
+                        | gimo::transform(gimo::pure(action));
+    CHECK(std::optional{44} == pipeline.apply(std::optional{42}));
+}
+
+TEST_CASE(
+    "transform_unconditionally invokes the action on every element.",
+    "[pure][simd]")
+{
+    std::array<float, 37> inputs{};
+    for (std::size_t i = 0u; i < inputs.size(); ++i)
+    {
+        inputs[i] = static_cast<float>(i);
+    }
+
+    auto action = gimo::pure([](auto const v) { return 2.f * v + 1.f; });
+
+    SECTION("When inputs and outputs are disjoint.")
+    {
+        std::array<float, 37> outputs{};
+        gimo::detail::transform_unconditionally(std::span<float const>{inputs}, std::span<float>{outputs}, action);
+
+        for (std::size_t i = 0u; i < inputs.size(); ++i)
+        {
+            CHECK(2.f * inputs[i] + 1.f == outputs[i]);
+        }
+    }
+
+    SECTION("When inputs and outputs are the same.")
+    {
+        std::array<float, 37> const expected = inputs;
+        gimo::detail::transform_unconditionally(std::span<float const>{inputs}, std::span<float>{inputs}, action);
+
+        for (std::size_t i = 0u; i < inputs.size(); ++i)
+        {
+            CHECK(2.f * expected[i] + 1.f == inputs[i]);
+        }
+    }
+}
@@ -0,0 +1,142 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/SentinelOptional.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <optional>
+
+using Id = gimo::sentinel_optional<int, -1>;
+
+TEST_CASE(
+    "sentinel_optional has the same size as its value type.",
+    "[sentinel_optional]")
+{
+    STATIC_CHECK(sizeof(int) == sizeof(Id));
+    STATIC_CHECK(sizeof(unsigned char) == sizeof(gimo::sentinel_optional<unsigned char, 0u>));
+    STATIC_CHECK(sizeof(int*) == sizeof(gimo::sentinel_optional<int*, nullptr>));
+}
+
+TEMPLATE_TEST_CASE(
+    "sentinel_optional satisfies gimo::nullable.",
+    "[sentinel_optional][concept]",
+    Id,
+    Id const,
+    Id&,
+    Id const&,
+    Id&&,
+    Id const&&)
+{
+    STATIC_CHECK(gimo::nullable<TestType>);
+}
+
+TEST_CASE(
+    "sentinel_optional treats the sentinel as null-state.",
+    "[sentinel_optional]")
+{
+    SECTION("When default constructed.")
+    {
+        constexpr Id opt{};
+        STATIC_CHECK(!opt.has_value());
+        STATIC_CHECK(std::nullopt == opt);
+    }
+
+    SECTION("When constructed from std::nullopt.")
+    {
+        constexpr Id opt{std::nullopt};
+        STATIC_CHECK(!opt.has_value());
+        STATIC_CHECK(std::nullopt == opt);
+    }
+
+    SECTION("When constructed from the sentinel.")
+    {
+        constexpr Id opt{-1};
+        STATIC_CHECK(!opt.has_value());
+        STATIC_CHECK(std::nullopt == opt);
+    }
+
+    SECTION("When constructed from any other value.")
+    {
+        constexpr Id opt{42};
+        STATIC_CHECK(opt.has_value());
+        STATIC_CHECK(std::nullopt != opt);
+        STATIC_CHECK(42 == *opt);
+    }
+
+    SECTION("When reset.")
+    {
+        Id opt{42};
+        opt = std::nullopt;
+        CHECK(!opt.has_value());
+        CHECK(1337 == opt.value_or(1337));
+    }
+}
+
+TEST_CASE(
+    "sentinel_optional rebinds to std::optional.",
+    "[sentinel_optional][trait]")
+{
+    STATIC_CHECK(std::same_as<std::optional<int>, gimo::rebind_value_t<Id, int>>);
+    STATIC_CHECK(std::same_as<std::optional<unsigned>, gimo::rebind_value_t<Id, unsigned>>);
+    STATIC_CHECK(std::same_as<std::optional<float*>, gimo::rebind_value_t<Id, float*>>);
+    STATIC_CHECK(std::same_as<std::optional<float>, gimo::rebind_value_t<Id, float>>);
+    STATIC_CHECK(std::same_as<std::optional<bool>, gimo::rebind_value_t<Id, bool>>);
+}
+
+TEST_CASE(
+    "Transforms on sentinel_optional may produce the sentinel.",
+    "[sentinel_optional][pipeline]")
+{
+    constexpr auto toSentinel = gimo::transform([](int const v) { return v - 43; });
+    constexpr auto increment = gimo::transform([](int const v) { return v + 1; });
+
+    SECTION("When applied stepwise.")
+    {
+        decltype(auto) intermediate = toSentinel.apply(Id{42});
+        STATIC_REQUIRE(std::same_as<std::optional<int>, decltype(intermediate)>);
+        CHECK(std::optional{-1} == intermediate);
+        CHECK(std::optional{0} == increment.apply(intermediate));
+    }
+
+    SECTION("When composed.")
+    {
+        CHECK(std::optional{0} == (toSentinel | increment).apply(Id{42}));
+        CHECK(std::optional{0} == gimo::pipe(toSentinel, increment).apply(Id{42}));
+    }
+
+    SECTION("When followed by another algorithm.")
+    {
+        constexpr auto pipeline = toSentinel
+                                | gimo::and_then([](int const v) { return std::optional{v}; });
+
+        CHECK(std::optional{-1} == pipeline.apply(Id{42}));
+    }
+}
+
+TEST_CASE(
+    "sentinel_optional can be used in pipelines.",
+    "[sentinel_optional][pipeline]")
+{
+    constexpr auto pipeline = gimo::transform([](int const v) { return v + 1; })
+                            | gimo::and_then([](int const v) { return Id{2 * v}; })
+                            | gimo::or_else([] { return Id{1337}; });
+
+    SECTION("When input has a value.")
+    {
+        decltype(auto) result = pipeline.apply(Id{42});
+        STATIC_REQUIRE(std::same_as<Id, decltype(result)>);
+        CHECK(86 == *result);
+    }
+
+    SECTION("When input is null.")
+    {
+        decltype(auto) result = pipeline.apply(Id{});
+        STATIC_REQUIRE(std::same_as<Id, decltype(result)>);
+        CHECK(1337 == *result);
+    }
+}
@@ -0,0 +1,131 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/TransformError.hpp"
+#include "gimo_ext/std_expected.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#ifdef __cpp_lib_expected
+
+    #include <expected>
+    #include <string>
+
+namespace
+{
+    enum class parse_error
+    {
+        empty,
+        invalid
+    };
+
+    using parsed = std::expected<int, parse_error>;
+
+    [[nodiscard]]
+    parsed parse_digit(std::string const& str)
+    {
+        if (str.empty())
+        {
+            return std::unexpected{parse_error::empty};
+        }
+
+        if (1u != str.size() || str.front() < '0' || '9' < str.front())
+        {
+            return std::unexpected{parse_error::invalid};
+        }
+
+        return str.front() - '0';
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "std::expected satisfies gimo::fallible.",
+    "[expected][concept]",
+    parsed,
+    parsed const&,
+    parsed&&,
+    (std::expected<std::string, int>))
+{
+    STATIC_CHECK(gimo::nullable<TestType>);
+    STATIC_CHECK(gimo::fallible<TestType>);
+}
+
+TEST_CASE(
+    "gimo::fallible requires an error.",
+    "[expected][concept]")
+{
+    STATIC_CHECK(!gimo::fallible<std::optional<int>>);
+    STATIC_CHECK(!gimo::nullable<std::expected<void, int>>);
+}
+
+TEST_CASE(
+    "Errors are propagated unchanged through and_then and transform.",
+    "[expected][algorithm]")
+{
+    auto const pipeline = gimo::and_then(&parse_digit)
+                        | gimo::transform([](int const digit) { return 2 * digit; })
+                        | gimo::and_then([](int const v) { return 10 <= v ? parsed{std::unexpect, parse_error::invalid} : parsed{v}; });
+
+    using Input = std::expected<std::string, parse_error>;
+    STATIC_CHECK(std::same_as<parsed, decltype(pipeline.apply(Input{}))>);
+
+    CHECK(parsed{8} == pipeline.apply(Input{"4"}));
+    CHECK(std::unexpected{parse_error::empty} == pipeline.apply(Input{""}));
+    CHECK(std::unexpected{parse_error::invalid} == pipeline.apply(Input{"7"}));
+    CHECK(std::unexpected{parse_error::empty} == pipeline.apply(Input{std::unexpect, parse_error::empty}));
+}
+
+TEST_CASE(
+    "or_else may receive the error of std::expected.",
+    "[expected][algorithm]")
+{
+    SECTION("When the action accepts the error.")
+    {
+        auto const pipeline = gimo::or_else([](parse_error const e) { return parse_error::empty == e ? parsed{0} : parsed{std::unexpect, e}; })
+                            | gimo::transform([](int const v) { return v + 1; });
+
+        CHECK(parsed{43} == pipeline.apply(parsed{42}));
+        CHECK(parsed{1} == pipeline.apply(parsed{std::unexpect, parse_error::empty}));
+        CHECK(std::unexpected{parse_error::invalid} == pipeline.apply(parsed{std::unexpect, parse_error::invalid}));
+    }
+
+    SECTION("When the action ignores the error.")
+    {
+        auto const pipeline = gimo::or_else([] { return parsed{0}; });
+
+        CHECK(parsed{42} == pipeline.apply(parsed{42}));
+        CHECK(parsed{0} == pipeline.apply(parsed{std::unexpect, parse_error::invalid}));
+    }
+}
+
+TEST_CASE(
+    "Errors are dropped, when the results can not carry them.",
+    "[expected][algorithm]")
+{
+    auto const pipeline = gimo::and_then([](int const v) { return std::optional{v}; })
+                        | gimo::transform([](int const v) { return v + 1; });
+
+    CHECK(std::optional{43} == pipeline.apply(parsed{42}));
+    CHECK(std::nullopt == pipeline.apply(parsed{std::unexpect, parse_error::empty}));
+}
+
+TEST_CASE(
+    "Errors are propagated by pipelines with an expectation.",
+    "[expected][pipeline]")
+{
+    auto const pipeline = gimo::transform([](int const v) { return v + 1; })
+                        | gimo::transform_error([](parse_error const e) { return static_cast<int>(e); });
+
+    using Result = std::expected<int, int>;
+    CHECK(Result{43} == gimo::expect_value(pipeline).apply(parsed{42}));
+    CHECK(std::unexpected{1} == gimo::expect_value(pipeline).apply(parsed{std::unexpect, parse_error::invalid}));
+    CHECK(Result{43} == gimo::expect_null(pipeline).apply(parsed{42}));
+    CHECK(std::unexpected{1} == gimo::expect_null(pipeline).apply(parsed{std::unexpect, parse_error::invalid}));
+}
+
+#endif
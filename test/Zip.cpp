@@ -0,0 +1,147 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Zip.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/pointers.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+
+namespace
+{
+    struct MoveCounter
+    {
+        inline static int moves{};
+
+        int value{};
+
+        [[nodiscard]]
+        explicit MoveCounter(int const v)
+            : value{v}
+        {
+        }
+
+        MoveCounter(MoveCounter const&) = default;
+        MoveCounter& operator=(MoveCounter const&) = default;
+
+        MoveCounter(MoveCounter&& other) noexcept
+            : value{other.value}
+        {
+            ++moves;
+        }
+
+        MoveCounter& operator=(MoveCounter&& other) noexcept
+        {
+            value = other.value;
+            ++moves;
+
+            return *this;
+        }
+    };
+}
+
+TEST_CASE(
+    "gimo::zipped satisfies gimo::nullable.",
+    "[zip][concept]")
+{
+    using Zipped = gimo::zipped<std::optional<int>&, std::optional<std::string> const&, std::optional<float>&&>;
+
+    STATIC_CHECK(gimo::nullable<Zipped>);
+    STATIC_CHECK(gimo::nullable<Zipped const&>);
+    STATIC_CHECK(std::same_as<std::tuple<int&, std::string const&, float&&>, gimo::reference_type_t<Zipped>>);
+}
+
+TEST_CASE(
+    "gimo::zip contains a value, if all nullables do.",
+    "[zip]")
+{
+    std::optional<int> const number{42};
+    std::optional<std::string> const text{"Hello, World!"};
+
+    CHECK(gimo::zip(number, text).has_value());
+    CHECK(gimo::zip(number, std::optional<std::string>{}) == std::nullopt);
+    CHECK(gimo::zip(std::optional<int>{}, text) == std::nullopt);
+    CHECK(gimo::zip(std::optional<int>{}, std::optional<std::string>{}) == std::nullopt);
+
+    auto const [numberRef, textRef] = *gimo::zip(number, text);
+    CHECK(&*number == &numberRef);
+    CHECK(&*text == &textRef);
+}
+
+TEST_CASE(
+    "gimo::transform_n invokes the action with each value of the zipped nullables.",
+    "[zip][algorithm][transform]")
+{
+    auto const pipeline = gimo::transform_n([](int const a, std::string const& b, float const c) {
+        return std::to_string(a) + b + std::to_string(static_cast<int>(c));
+    });
+
+    std::optional<int> const number{42};
+    std::optional<std::string> const text{"-"};
+    STATIC_CHECK(std::same_as<std::optional<std::string>, decltype(pipeline.apply(gimo::zip(number, text, std::optional{1.f})))>);
+
+    CHECK(std::optional<std::string>{"42-1"} == pipeline.apply(gimo::zip(number, text, std::optional{1.f})));
+    CHECK(std::nullopt == pipeline.apply(gimo::zip(number, text, std::optional<float>{})));
+    CHECK(std::nullopt == pipeline.apply(gimo::zip(std::optional<int>{}, text, std::optional{1.f})));
+}
+
+TEST_CASE(
+    "gimo::transform_n forwards the value-category of each zipped nullable.",
+    "[zip][algorithm][transform]")
+{
+    std::optional<std::string> source{"Hello, World!"};
+    std::optional<int> const number{42};
+
+    auto const pipeline = gimo::transform_n([](std::string&& str, int const& n) { return std::string{std::move(str)} + std::to_string(n); });
+
+    CHECK(std::optional<std::string>{"Hello, World!42"} == pipeline.apply(gimo::zip(std::move(source), number)));
+}
+
+TEST_CASE(
+    "gimo::transform_n supports follow-up steps.",
+    "[zip][algorithm]")
+{
+    auto const pipeline = gimo::transform_n([](int const a, int const b) { return a + b; })
+                        | gimo::and_then([](int const sum) { return 0 < sum ? std::optional{sum} : std::nullopt; })
+                        | gimo::or_else([] { return std::optional{-1}; });
+
+    CHECK(std::optional{3} == pipeline.apply(gimo::zip(std::optional{1}, std::optional{2})));
+    CHECK(std::optional{-1} == pipeline.apply(gimo::zip(std::optional{1}, std::optional{-2})));
+    CHECK(std::optional{-1} == pipeline.apply(gimo::zip(std::optional<int>{}, std::optional{2})));
+}
+
+TEST_CASE(
+    "gimo::transform_n constructs the result directly into the rebound nullable.",
+    "[zip][algorithm][transform]")
+{
+    MoveCounter::moves = 0;
+
+    auto const pipeline = gimo::transform_n([](int const a, int const b) { return MoveCounter{a * b}; });
+
+    std::optional const result = pipeline.apply(gimo::zip(std::optional{6}, std::optional{7}));
+    REQUIRE(result.has_value());
+    CHECK(42 == result->value);
+    CHECK(0 == MoveCounter::moves);
+}
+
+TEST_CASE(
+    "gimo::transform_n rebinds the result like the first zipped nullable.",
+    "[zip][algorithm][transform]")
+{
+    std::string name{"gimo"};
+    std::optional<int> const id{42};
+
+    auto const pipeline = gimo::transform_n([](std::string& str, [[maybe_unused]] int const n) -> std::string& { return str; });
+
+    STATIC_CHECK(std::same_as<std::string*, decltype(pipeline.apply(gimo::zip(&name, id)))>);
+    CHECK(&name == pipeline.apply(gimo::zip(&name, id)));
+    CHECK(nullptr == pipeline.apply(gimo::zip(static_cast<std::string*>(nullptr), id)));
+}
@@ -4,10 +4,14 @@
 //           https://www.boost.org/LICENSE_1_0.txt)
 
 #include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo_ext/pointers.hpp"
 #include "gimo_ext/std_optional.hpp"
 
 #include "TestCommons.hpp"
 
+#include <memory>
+
 using namespace gimo;
 
 TEMPLATE_LIST_TEST_CASE(
@@ -143,3 +147,147 @@ TEMPLATE_LIST_TEST_CASE(
         and finally::returns(4.2f);
     CHECK(std::optional{4.2f} == pipeline.apply(std::optional<int>{1337}));
 }
+
+TEST_CASE(
+    "Adjacent transform steps are fused into a single step.",
+    "[algorithm][pipeline]")
+{
+    mimicpp::Mock<float(int) const> const first{};
+    mimicpp::Mock<int(float) const> const second{};
+    mimicpp::Mock<double(int) const> const third{};
+
+    auto const pipeline = transform(std::cref(first))
+                        | transform(std::cref(second))
+                        | transform(std::cref(third));
+
+    using Action = detail::transform::composition<
+        detail::transform::composition<
+            std::reference_wrapper<decltype(first)>,
+            std::reference_wrapper<decltype(second)>>,
+        std::reference_wrapper<decltype(third)>>;
+    STATIC_CHECK(std::same_as<Pipeline<detail::transform_t<Action>> const, decltype(pipeline)>);
+
+    SECTION("When input has a value, all actions are invoked in order.")
+    {
+        mimicpp::ScopedSequence sequence{};
+        sequence += first.expect_call(42)
+                and finally::returns(4.2f);
+        sequence += second.expect_call(4.2f)
+                and finally::returns(1337);
+        sequence += third.expect_call(1337)
+                and finally::returns(13.37);
+
+        decltype(auto) result = pipeline.apply(std::optional{42});
+        STATIC_REQUIRE(std::same_as<std::optional<double>, decltype(result)>);
+        CHECK(13.37 == result);
+    }
+
+    SECTION("When input is empty, no action is invoked.")
+    {
+        decltype(auto) result = pipeline.apply(std::optional<int>{});
+        STATIC_REQUIRE(std::same_as<std::optional<double>, decltype(result)>);
+        CHECK(!result);
+    }
+}
+
+TEST_CASE(
+    "Transform steps separated by other algorithms are not fused.",
+    "[algorithm][pipeline]")
+{
+    auto const pipeline = transform([](int const v) { return v + 1; })
+                        | and_then([](int const v) { return std::optional{v}; })
+                        | transform([](int const v) { return v * 2; });
+
+    constexpr auto stepCount = []<typename... Steps>([[maybe_unused]] std::type_identity<Pipeline<Steps...>> const type) {
+        return sizeof...(Steps);
+    };
+    STATIC_CHECK(3u == stepCount(std::type_identity<std::remove_const_t<decltype(pipeline)>>{}));
+    CHECK(std::optional{86} == pipeline.apply(std::optional{42}));
+    CHECK(std::nullopt == pipeline.apply(std::optional<int>{}));
+}
+
+TEST_CASE(
+    "Fused transform steps behave like separate ones.",
+    "[algorithm][pipeline]")
+{
+    SECTION("The intermediate value is passed as rvalue.")
+    {
+        auto const pipeline = transform([](int const v) { return v + 1; })
+                            | transform([]<typename T>([[maybe_unused]] T&& v) { return std::is_rvalue_reference_v<T&&>; });
+
+        CHECK(std::optional{true} == pipeline.apply(std::optional{42}));
+    }
+
+    SECTION("When the intermediate nullable is not a std::optional, the steps are executed in sequence.")
+    {
+        struct Node
+        {
+            int value{};
+        };
+
+        auto const node = std::make_shared<Node>(42);
+        auto const pipeline = transform(&Node::value)
+                            | transform([&](int const& v) { return &v == &node->value; });
+
+        using Step = std::tuple_element_t<0u, std::remove_cvref_t<decltype(pipeline.steps())>>;
+        STATIC_CHECK(detail::transform::staged<typename Step::action_type const&, std::shared_ptr<Node>>);
+        STATIC_CHECK(!detail::transform::staged<typename Step::action_type const&, std::optional<Node>>);
+
+        decltype(auto) result = pipeline.apply(node);
+        STATIC_REQUIRE(std::same_as<std::optional<bool>, decltype(result)>);
+        CHECK(std::optional{true} == result);
+        CHECK(std::nullopt == pipeline.apply(std::shared_ptr<Node>{}));
+    }
+}
+
+namespace
+{
+    struct MoveCounter
+    {
+        inline static int moves{};
+
+        MoveCounter() = default;
+
+        MoveCounter(MoveCounter const&) = default;
+        MoveCounter& operator=(MoveCounter const&) = default;
+
+        MoveCounter(MoveCounter&&) noexcept
+        {
+            ++moves;
+        }
+
+        MoveCounter& operator=(MoveCounter&&) noexcept
+        {
+            ++moves;
+
+            return *this;
+        }
+    };
+}
+
+TEST_CASE(
+    "transform constructs the results of its action in place.",
+    "[algorithm]")
+{
+    MoveCounter::moves = 0;
+
+    SECTION("When the transform is the last step.")
+    {
+        auto const pipeline = transform([](int const v) { return 2 * v; })
+                            | transform([]([[maybe_unused]] int const v) { return MoveCounter{}; });
+
+        decltype(auto) result = pipeline.apply(std::optional{42});
+        STATIC_REQUIRE(std::same_as<std::optional<MoveCounter>, decltype(result)>);
+        CHECK(result);
+        CHECK(0 == MoveCounter::moves);
+    }
+
+    SECTION("When further steps follow.")
+    {
+        auto const pipeline = transform([]([[maybe_unused]] int const v) { return MoveCounter{}; })
+                            | and_then([]([[maybe_unused]] MoveCounter const& v) { return std::optional{1337}; });
+
+        CHECK(std::optional{1337} == pipeline.apply(std::optional{42}));
+        CHECK(0 == MoveCounter::moves);
+    }
+}
@@ -0,0 +1,96 @@
+//           Copyright Dominic (DNKpp) Koepke 2025.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/algorithm/TransformError.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_expected.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include "TestCommons.hpp"
+
+#ifdef __cpp_lib_expected
+
+using namespace gimo;
+
+TEMPLATE_LIST_TEST_CASE(
+    "transform_error algorithm invokes its action with the contained error, when there is any.",
+    "[algorithm]",
+    testing::with_qualification_list)
+{
+    using with_qualification = TestType;
+
+    mimicpp::Mock<
+        int(float)&,
+        int(float) const&,
+        int(float)&&,
+        int(float) const&&>
+        action{};
+
+    using Algorithm = detail::transform_error_t<decltype(action)>;
+    STATIC_REQUIRE(gimo::applicable_on<std::expected<std::string, float>, typename with_qualification::template type<Algorithm>>);
+    STATIC_REQUIRE(!gimo::applicable_on<std::optional<float>, typename with_qualification::template type<Algorithm>>);
+
+    SECTION("When input has an error, the action is invoked.")
+    {
+        SCOPED_EXP with_qualification::cast(action).expect_call(1337.f)
+            and finally::returns(42);
+
+        std::expected<std::string, float> const input{std::unexpect, 1337.f};
+        Algorithm transformError{std::move(action)};
+
+        decltype(auto) result = with_qualification::cast(transformError)(input);
+        STATIC_REQUIRE(std::same_as<std::expected<std::string, int>, decltype(result)>);
+        REQUIRE(!result);
+        CHECK(42 == result.error());
+    }
+
+    SECTION("When input has a value, action is not invoked.")
+    {
+        Algorithm transformError{std::move(action)};
+        std::expected<std::string, float> const input{"Hello, World!"};
+
+        decltype(auto) result = with_qualification::cast(transformError)(input);
+        STATIC_REQUIRE(std::same_as<std::expected<std::string, int>, decltype(result)>);
+        REQUIRE(result);
+        CHECK("Hello, World!" == *result);
+    }
+}
+
+TEST_CASE(
+    "gimo::transform_error creates an appropriate pipeline.",
+    "[algorithm]")
+{
+    mimicpp::Mock<float(int) const> const inner{};
+    auto action = [&](int const v) { return inner(v); };
+    using DummyAction = decltype(action);
+
+    auto const pipeline = transform_error(action);
+    STATIC_CHECK(std::same_as<Pipeline<detail::transform_error_t<DummyAction>> const, decltype(pipeline)>);
+
+    SCOPED_EXP inner.expect_call(1337)
+        and finally::returns(4.2f);
+    decltype(auto) result = pipeline.apply(std::expected<std::string, int>{std::unexpect, 1337});
+    STATIC_REQUIRE(std::same_as<std::expected<std::string, float>, decltype(result)>);
+    REQUIRE(!result);
+    CHECK(4.2f == result.error());
+}
+
+TEST_CASE(
+    "transform_error passes values through to the following steps.",
+    "[algorithm][pipeline]")
+{
+    auto const pipeline = transform_error([](int const e) { return static_cast<float>(e) / 2.f; })
+                        | transform([](std::string const& str) { return str.size(); });
+
+    decltype(auto) result = pipeline.apply(std::expected<std::string, int>{"Hello, World!"});
+    STATIC_REQUIRE(std::same_as<std::expected<std::size_t, float>, decltype(result)>);
+    CHECK(13u == result);
+
+    result = pipeline.apply(std::expected<std::string, int>{std::unexpect, 42});
+    REQUIRE(!result);
+    CHECK(21.f == result.error());
+}
+
+#endif
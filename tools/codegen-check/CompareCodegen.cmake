@@ -0,0 +1,103 @@
+#          Copyright Dominic (DNKpp) Koepke 2025.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          https://www.boost.org/LICENSE_1_0.txt)
+
+# Disassembles the given object files and compares each `gimo_<case>` function with its `hand_<case>` counterpart.
+# Fails, when a gimo function exceeds the instruction- or call-count of its counterpart by more than the given thresholds.
+#
+# Expected variables:
+#   OBJDUMP                 - path to the objdump executable
+#   OBJECTS                 - list of object files
+#   MAX_EXTRA_INSTRUCTIONS  - number of additional instructions a gimo function may have
+#   MAX_EXTRA_CALLS         - number of additional calls a gimo function may have
+#
+# Optional variables:
+#   BASELINE                - file, which pins the known instruction gaps of single cases via `EXTRA_INSTRUCTIONS_<case>`
+
+foreach (variable IN ITEMS OBJDUMP OBJECTS MAX_EXTRA_INSTRUCTIONS MAX_EXTRA_CALLS)
+    if (NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not defined.")
+    endif ()
+endforeach ()
+
+if (BASELINE)
+    if (NOT EXISTS "${BASELINE}")
+        message(FATAL_ERROR "Baseline ${BASELINE} does not exist.")
+    endif ()
+
+    include("${BASELINE}")
+endif ()
+
+set(CASES "")
+foreach (object IN LISTS OBJECTS)
+    execute_process(
+        COMMAND "${OBJDUMP}" -d -C --no-show-raw-insn "${object}"
+        OUTPUT_VARIABLE DISASSEMBLY
+        RESULT_VARIABLE RESULT
+    )
+    if (NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "Failed to disassemble ${object}.")
+    endif ()
+
+    # Semicolons would otherwise be treated as list separators.
+    string(REPLACE ";" "," DISASSEMBLY "${DISASSEMBLY}")
+    string(REPLACE "\n" ";" LINES "${DISASSEMBLY}")
+
+    set(CURRENT "")
+    foreach (line IN LISTS LINES)
+        if (line MATCHES "^[0-9a-f]+ <_?(gimo|hand)_([A-Za-z0-9_]+)\\(.*>:$")
+            set(CURRENT "${CMAKE_MATCH_1}_${CMAKE_MATCH_2}")
+            list(APPEND CASES "${CMAKE_MATCH_2}")
+            set(INSTRUCTIONS_${CURRENT} 0)
+            set(CALLS_${CURRENT} 0)
+        elseif (line MATCHES "^[0-9a-f]+ <")
+            set(CURRENT "")
+        elseif (CURRENT AND line MATCHES "^ +[0-9a-f]+:\t")
+            # Padding does not count, as it is never executed.
+            if (line MATCHES "\t(nop|xchg +%?ax, *%?ax|data16|cs nop|int3)")
+                continue()
+            endif ()
+
+            math(EXPR INSTRUCTIONS_${CURRENT} "${INSTRUCTIONS_${CURRENT}} + 1")
+            if (line MATCHES "\t(call|bl|blr) ")
+                math(EXPR CALLS_${CURRENT} "${CALLS_${CURRENT}} + 1")
+            endif ()
+        endif ()
+    endforeach ()
+endforeach ()
+
+list(REMOVE_DUPLICATES CASES)
+if (NOT CASES)
+    message(FATAL_ERROR "No cases found.")
+endif ()
+
+set(FAILURES 0)
+foreach (case IN LISTS CASES)
+    if (NOT DEFINED INSTRUCTIONS_gimo_${case} OR NOT DEFINED INSTRUCTIONS_hand_${case})
+        message(SEND_ERROR "Case ${case} requires both, a gimo_${case} and a hand_${case} function.")
+        math(EXPR FAILURES "${FAILURES} + 1")
+        continue()
+    endif ()
+
+    if (NOT DEFINED EXTRA_INSTRUCTIONS_${case})
+        set(EXTRA_INSTRUCTIONS_${case} 0)
+    endif ()
+
+    math(EXPR ALLOWED_INSTRUCTIONS "${MAX_EXTRA_INSTRUCTIONS} + ${EXTRA_INSTRUCTIONS_${case}}")
+    math(EXPR EXTRA_INSTRUCTIONS "${INSTRUCTIONS_gimo_${case}} - ${INSTRUCTIONS_hand_${case}}")
+    math(EXPR EXTRA_CALLS "${CALLS_gimo_${case}} - ${CALLS_hand_${case}}")
+    set(SUMMARY "${case}: ${INSTRUCTIONS_gimo_${case}} vs ${INSTRUCTIONS_hand_${case}} instructions (baseline +${EXTRA_INSTRUCTIONS_${case}}), ${CALLS_gimo_${case}} vs ${CALLS_hand_${case}} calls")
+    if (EXTRA_INSTRUCTIONS GREATER ALLOWED_INSTRUCTIONS OR EXTRA_CALLS GREATER MAX_EXTRA_CALLS)
+        message(SEND_ERROR "${SUMMARY}")
+        math(EXPR FAILURES "${FAILURES} + 1")
+    elseif (EXTRA_INSTRUCTIONS LESS EXTRA_INSTRUCTIONS_${case} AND EXTRA_INSTRUCTIONS_${case} GREATER 0)
+        message(STATUS "${SUMMARY} - the baseline may be tightened")
+    else ()
+        message(STATUS "${SUMMARY}")
+    endif ()
+endforeach ()
+
+if (FAILURES GREATER 0)
+    message(FATAL_ERROR "${FAILURES} case(s) exceed the thresholds.")
+endif ()
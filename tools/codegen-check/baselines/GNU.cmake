@@ -0,0 +1,14 @@
+#          Copyright Dominic (DNKpp) Koepke 2025.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          https://www.boost.org/LICENSE_1_0.txt)
+
+# Instruction gaps, which gcc (12, at -O2 and -O3) is known to produce for the gimo cases.
+# None of them contains additional branches or calls; gcc rather spills the intermediate std::optionals to the stack
+# and duplicates the return sequences. Lower them, whenever a gap is closed.
+
+set(EXTRA_INSTRUCTIONS_and_then_chain 8)
+set(EXTRA_INSTRUCTIONS_transform_chain 6)
+set(EXTRA_INSTRUCTIONS_or_else 6)
+set(EXTRA_INSTRUCTIONS_rvalue_payload 3)
+set(EXTRA_INSTRUCTIONS_and_then_transform 5)
@@ -0,0 +1,192 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// Each `gimo_<case>` function must compile to the same code as its `hand_<case>` counterpart.
+// The functions have external linkage, so that they are emitted and can be found by name in the demangled disassembly.
+
+#include "gimo/Instrumentation.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <array>
+#include <optional>
+#include <utility>
+
+namespace
+{
+    using payload = std::array<int, 8>;
+
+    // Function references are not supported as actions, thus lambdas are used instead.
+    constexpr auto half = [](int const value) noexcept {
+        return 0 == value % 2 ? std::optional{value / 2} : std::nullopt;
+    };
+
+    constexpr auto to_float = [](int const value) noexcept {
+        return static_cast<float>(value) + 0.5f;
+    };
+
+    constexpr auto twice = [](int const value) noexcept {
+        return 2 * value;
+    };
+
+    constexpr auto fallback = []() noexcept {
+        return std::optional{42};
+    };
+
+    constexpr auto bump = [](payload value) noexcept {
+        ++value.front();
+
+        return value;
+    };
+
+    // GIMO_CONFIG_INSTRUMENTATION is not defined, thus instrumented pipelines must not differ from plain ones.
+    gimo::probe_registry registry{};
+}
+
+[[gnu::noinline]]
+std::optional<int> gimo_and_then_chain(std::optional<int> const& opt)
+{
+    return gimo::apply(opt, gimo::and_then(half) | gimo::and_then(half) | gimo::and_then(half));
+}
+
+[[gnu::noinline]]
+std::optional<int> hand_and_then_chain(std::optional<int> const& opt)
+{
+    if (!opt)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<int> const first = half(*opt);
+    if (!first)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<int> const second = half(*first);
+    if (!second)
+    {
+        return std::nullopt;
+    }
+
+    return half(*second);
+}
+
+[[gnu::noinline]]
+std::optional<float> gimo_transform_chain(std::optional<int> const& opt)
+{
+    return gimo::apply(opt, gimo::transform(twice) | gimo::transform(to_float));
+}
+
+[[gnu::noinline]]
+std::optional<float> hand_transform_chain(std::optional<int> const& opt)
+{
+    if (!opt)
+    {
+        return std::nullopt;
+    }
+
+    return to_float(twice(*opt));
+}
+
+[[gnu::noinline]]
+std::optional<int> gimo_or_else(std::optional<int> const& opt)
+{
+    return gimo::apply(opt, gimo::or_else(fallback));
+}
+
+[[gnu::noinline]]
+std::optional<int> hand_or_else(std::optional<int> const& opt)
+{
+    if (!opt)
+    {
+        return fallback();
+    }
+
+    return opt;
+}
+
+[[gnu::noinline]]
+std::optional<int> gimo_mixed_chain(std::optional<int> const& opt)
+{
+    return gimo::apply(opt, gimo::and_then(half) | gimo::transform(twice) | gimo::or_else(fallback));
+}
+
+[[gnu::noinline]]
+std::optional<int> hand_mixed_chain(std::optional<int> const& opt)
+{
+    if (opt)
+    {
+        if (std::optional<int> const result = half(*opt))
+        {
+            return twice(*result);
+        }
+    }
+
+    return fallback();
+}
+
+[[gnu::noinline]]
+std::optional<payload> gimo_rvalue_payload(std::optional<payload>&& opt)
+{
+    return gimo::apply(std::move(opt), gimo::transform(bump) | gimo::transform(bump));
+}
+
+[[gnu::noinline]]
+std::optional<payload> hand_rvalue_payload(std::optional<payload>&& opt)
+{
+    if (!opt)
+    {
+        return std::nullopt;
+    }
+
+    return bump(bump(std::move(*opt)));
+}
+
+[[gnu::noinline]]
+std::optional<int> gimo_and_then_transform(std::optional<int> const& opt)
+{
+    return gimo::apply(opt, gimo::and_then(half) | gimo::transform(twice));
+}
+
+[[gnu::noinline]]
+std::optional<int> hand_and_then_transform(std::optional<int> const& opt)
+{
+    if (!opt)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<int> const result = half(*opt);
+    if (!result)
+    {
+        return std::nullopt;
+    }
+
+    return twice(*result);
+}
+
+[[gnu::noinline]]
+std::optional<int> gimo_instrumented_chain(std::optional<int> const& opt)
+{
+    auto const pipeline = gimo::instrument(
+        registry,
+        "instrumented_chain",
+        gimo::and_then(half) | gimo::transform(twice));
+
+    return pipeline.apply(opt);
+}
+
+// The instrumentation is compared with the plain pipeline, so that any difference must stem from the probe.
+[[gnu::noinline]]
+std::optional<int> hand_instrumented_chain(std::optional<int> const& opt)
+{
+    auto const pipeline = gimo::and_then(half) | gimo::transform(twice);
+
+    return pipeline.apply(opt);
+}
@@ -0,0 +1,205 @@
+#          Copyright Dominic (DNKpp) Koepke 2025.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          https://www.boost.org/LICENSE_1_0.txt)
+
+# Compiles the pipeline source for each combination of nullable, composition and step-count with the frontend only
+# and writes the measurements in the json format of google-benchmark, so that the same tooling can be used for tracking.
+# Additionally, the sizes of the optimized object file and of its debug information are recorded.
+#
+# Expected variables:
+#   COMPILER        - path to the c++ compiler
+#   COMPILER_ID     - either GNU or Clang
+#   STANDARD        - the c++ standard
+#   INCLUDE_DIR     - the gimo include directory
+#   SOURCE          - the pipeline source file
+#   NULLABLES       - comma separated list of nullables
+#   COMPOSITIONS    - comma separated list of compositions (`operator` and/or `pipe`)
+#   STEPS           - comma separated list of step-counts
+#   REPETITIONS     - how often each case is compiled; the fastest run is reported
+#   WORK_DIR        - directory for intermediate files
+#   OUTPUT          - the json file to write
+
+foreach (variable IN ITEMS COMPILER COMPILER_ID STANDARD INCLUDE_DIR SOURCE NULLABLES COMPOSITIONS STEPS REPETITIONS WORK_DIR OUTPUT)
+    if (NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not defined.")
+    endif ()
+endforeach ()
+
+string(REPLACE "," ";" NULLABLES "${NULLABLES}")
+string(REPLACE "," ";" COMPOSITIONS "${COMPOSITIONS}")
+string(REPLACE "," ";" STEPS "${STEPS}")
+
+# Converts a decimal amount of seconds (e.g. 1.25) into whole milliseconds.
+function (seconds_to_milliseconds seconds out)
+    if (NOT seconds MATCHES "^([0-9]+)\\.([0-9]+)$")
+        message(FATAL_ERROR "Unexpected time format: ${seconds}")
+    endif ()
+
+    set(integral "${CMAKE_MATCH_1}")
+    string(SUBSTRING "${CMAKE_MATCH_2}000" 0 3 fraction)
+    math(EXPR milliseconds "${integral} * 1000 + ${fraction}")
+    set(${out} ${milliseconds} PARENT_SCOPE)
+endfunction ()
+
+# Converts a gcc memory amount (e.g. 52M) into kilobytes.
+function (gcc_memory_to_kilobytes amount out)
+    if (NOT amount MATCHES "^([0-9]+)([kMG]?)$")
+        message(FATAL_ERROR "Unexpected memory format: ${amount}")
+    endif ()
+
+    set(kilobytes ${CMAKE_MATCH_1})
+    if (CMAKE_MATCH_2 STREQUAL "")
+        math(EXPR kilobytes "${kilobytes} / 1024")
+    elseif (CMAKE_MATCH_2 STREQUAL "M")
+        math(EXPR kilobytes "${kilobytes} * 1024")
+    elseif (CMAKE_MATCH_2 STREQUAL "G")
+        math(EXPR kilobytes "${kilobytes} * 1024 * 1024")
+    endif ()
+    set(${out} ${kilobytes} PARENT_SCOPE)
+endfunction ()
+
+function (make_command nullable composition steps out)
+    set(command
+        "${COMPILER}"
+        "-std=c++${STANDARD}"
+        "-I${INCLUDE_DIR}"
+        "-DGIMO_COMPILE_BENCHMARK_NULLABLE=${nullable}"
+        "-DGIMO_COMPILE_BENCHMARK_STEPS=${steps}"
+    )
+    if (composition STREQUAL "pipe")
+        list(APPEND command "-DGIMO_COMPILE_BENCHMARK_PIPE")
+    elseif (NOT composition STREQUAL "operator")
+        message(FATAL_ERROR "Unknown composition: ${composition}")
+    endif ()
+    set(${out} ${command} PARENT_SCOPE)
+endfunction ()
+
+# Sets `OBJECT_BYTES` and `DEBUG_BYTES` in the parent scope.
+function (measure_size nullable composition steps)
+    make_command(${nullable} ${composition} ${steps} COMMAND)
+
+    foreach (variant IN ITEMS release debug)
+        set(FLAGS -O2)
+        if (variant STREQUAL "debug")
+            list(APPEND FLAGS -g)
+        endif ()
+
+        set(OBJECT_FILE "${WORK_DIR}/${nullable}-${composition}-${steps}-${variant}.o")
+        execute_process(
+            COMMAND ${COMMAND} ${FLAGS} -c "${SOURCE}" -o "${OBJECT_FILE}"
+            ERROR_VARIABLE REPORT
+            RESULT_VARIABLE RESULT
+        )
+        if (NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "Compilation failed:\n${REPORT}")
+        endif ()
+        file(SIZE "${OBJECT_FILE}" SIZE_${variant})
+    endforeach ()
+
+    math(EXPR DEBUG_BYTES "${SIZE_debug} - ${SIZE_release}")
+    set(OBJECT_BYTES ${SIZE_release} PARENT_SCOPE)
+    set(DEBUG_BYTES ${DEBUG_BYTES} PARENT_SCOPE)
+endfunction ()
+
+# Sets `FRONTEND_MS`, `INSTANTIATION_MS`, `MEMORY_KB` and `INSTANTIATIONS` in the parent scope.
+# Values, which are not reported by the compiler, are set to -1.
+function (measure nullable composition steps)
+    make_command(${nullable} ${composition} ${steps} COMMAND)
+    list(APPEND COMMAND -fsyntax-only)
+
+    set(MEMORY_KB -1)
+    set(INSTANTIATIONS -1)
+    if (COMPILER_ID STREQUAL "GNU")
+        execute_process(
+            COMMAND ${COMMAND} -ftime-report "${SOURCE}"
+            ERROR_VARIABLE REPORT
+            RESULT_VARIABLE RESULT
+        )
+        if (NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "Compilation failed:\n${REPORT}")
+        endif ()
+
+        set(TIME_PATTERN "[0-9.]+ +\\( *[0-9]+%\\) +[0-9.]+ +\\( *[0-9]+%\\) +([0-9.]+)")
+        if (NOT REPORT MATCHES "\n TOTAL +: +[0-9.]+ +[0-9.]+ +([0-9.]+) +([0-9]+[kMG]?)")
+            message(FATAL_ERROR "Unexpected time report:\n${REPORT}")
+        endif ()
+        seconds_to_milliseconds(${CMAKE_MATCH_1} FRONTEND_MS)
+        gcc_memory_to_kilobytes(${CMAKE_MATCH_2} MEMORY_KB)
+
+        set(INSTANTIATION_MS 0)
+        if (REPORT MATCHES "\n template instantiation +: +${TIME_PATTERN}")
+            seconds_to_milliseconds(${CMAKE_MATCH_1} INSTANTIATION_MS)
+        endif ()
+    elseif (COMPILER_ID MATCHES "Clang")
+        set(TRACE_FILE "${WORK_DIR}/${nullable}-${composition}-${steps}.json")
+        execute_process(
+            COMMAND ${COMMAND} "-ftime-trace=${TRACE_FILE}" -ftime-trace-granularity=0 "${SOURCE}"
+            ERROR_VARIABLE REPORT
+            RESULT_VARIABLE RESULT
+        )
+        if (NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "Compilation failed:\n${REPORT}")
+        endif ()
+
+        file(READ "${TRACE_FILE}" TRACE)
+        if (NOT TRACE MATCHES "\"dur\":([0-9]+),\"name\":\"Total Frontend\"")
+            message(FATAL_ERROR "Trace file does not contain the frontend time: ${TRACE_FILE}")
+        endif ()
+        math(EXPR FRONTEND_MS "${CMAKE_MATCH_1} / 1000")
+
+        set(INSTANTIATION_MS 0)
+        if (TRACE MATCHES "\"dur\":([0-9]+),\"name\":\"Total InstantiateClass\"")
+            math(EXPR INSTANTIATION_MS "${INSTANTIATION_MS} + ${CMAKE_MATCH_1} / 1000")
+        endif ()
+        if (TRACE MATCHES "\"dur\":([0-9]+),\"name\":\"Total InstantiateFunction\"")
+            math(EXPR INSTANTIATION_MS "${INSTANTIATION_MS} + ${CMAKE_MATCH_1} / 1000")
+        endif ()
+
+        # With a granularity of zero, each single instantiation is recorded as an event.
+        string(REGEX MATCHALL "\"name\":\"Instantiate(Class|Function)\"" EVENTS "${TRACE}")
+        list(LENGTH EVENTS INSTANTIATIONS)
+    else ()
+        message(FATAL_ERROR "Unsupported compiler: ${COMPILER_ID}")
+    endif ()
+
+    set(FRONTEND_MS ${FRONTEND_MS} PARENT_SCOPE)
+    set(INSTANTIATION_MS ${INSTANTIATION_MS} PARENT_SCOPE)
+    set(MEMORY_KB ${MEMORY_KB} PARENT_SCOPE)
+    set(INSTANTIATIONS ${INSTANTIATIONS} PARENT_SCOPE)
+endfunction ()
+
+file(MAKE_DIRECTORY "${WORK_DIR}")
+
+set(ENTRIES "")
+foreach (nullable IN LISTS NULLABLES)
+    foreach (composition IN LISTS COMPOSITIONS)
+        foreach (steps IN LISTS STEPS)
+            set(BEST_MS -1)
+            foreach (repetition RANGE 1 ${REPETITIONS})
+                measure(${nullable} ${composition} ${steps})
+                if (BEST_MS LESS 0 OR FRONTEND_MS LESS BEST_MS)
+                    set(BEST_MS ${FRONTEND_MS})
+                    set(BEST_INSTANTIATION_MS ${INSTANTIATION_MS})
+                endif ()
+            endforeach ()
+            measure_size(${nullable} ${composition} ${steps})
+
+            set(NAME "${nullable}/${composition}/steps:${steps}")
+            message(STATUS "${NAME}: ${BEST_MS} ms frontend, ${BEST_INSTANTIATION_MS} ms instantiation, ${MEMORY_KB} kB, ${INSTANTIATIONS} instantiations, ${OBJECT_BYTES} B object, ${DEBUG_BYTES} B debug-info")
+            list(APPEND ENTRIES
+                "    {\"name\": \"${NAME}\", \"run_name\": \"${NAME}\", \"run_type\": \"iteration\", \"repetitions\": ${REPETITIONS}, \"threads\": 1, \"iterations\": 1, \"real_time\": ${BEST_MS}, \"cpu_time\": ${BEST_MS}, \"time_unit\": \"ms\", \"instantiation_ms\": ${BEST_INSTANTIATION_MS}, \"memory_kb\": ${MEMORY_KB}, \"instantiations\": ${INSTANTIATIONS}, \"object_bytes\": ${OBJECT_BYTES}, \"debug_bytes\": ${DEBUG_BYTES}}"
+            )
+        endforeach ()
+    endforeach ()
+endforeach ()
+
+string(TIMESTAMP DATE "%Y-%m-%dT%H:%M:%S")
+list(JOIN ENTRIES ",\n" BENCHMARKS)
+file(WRITE "${OUTPUT}"
+    "{\n"
+    "  \"context\": {\"date\": \"${DATE}\", \"executable\": \"gimo-compile-benchmarks\", \"compiler\": \"${COMPILER_ID}\", \"cxx_standard\": ${STANDARD}},\n"
+    "  \"benchmarks\": [\n${BENCHMARKS}\n  ]\n"
+    "}\n"
+)
+message(STATUS "Results written to ${OUTPUT}")
@@ -0,0 +1,122 @@
+#          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          https://www.boost.org/LICENSE_1_0.txt)
+
+# Compares the build times of a consumer, which either includes the gimo headers or imports the gimo modules.
+# As the module interfaces are built only once per project, their build time is reported separately.
+# The measurements are wall-clock times of complete compiler invocations and are written in the json format of
+# google-benchmark.
+#
+# Expected variables:
+#   COMPILER        - path to the c++ compiler
+#   COMPILER_ID     - either GNU or Clang
+#   STANDARD        - the c++ standard
+#   INCLUDE_DIR     - the gimo include directory
+#   MODULE_DIR      - the directory of the gimo module interface units
+#   SOURCE          - the consumer source file
+#   REPETITIONS     - how often each case is compiled; the fastest run is reported
+#   WORK_DIR        - directory for intermediate files
+#   OUTPUT          - the json file to write
+
+foreach (variable IN ITEMS COMPILER COMPILER_ID STANDARD INCLUDE_DIR MODULE_DIR SOURCE REPETITIONS WORK_DIR OUTPUT)
+    if (NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not defined.")
+    endif ()
+endforeach ()
+
+if (CMAKE_VERSION VERSION_LESS 3.23)
+    message(FATAL_ERROR "At least cmake 3.23 is required for measuring sub-second durations.")
+endif ()
+
+# Runs the commands one after another in the work directory and sets `ELAPSED_MS` in the parent scope.
+# Each command is expected as a single `;`-separated list.
+function (run_timed)
+    string(TIMESTAMP BEGIN "%s%f" UTC)
+    foreach (command IN LISTS ARGN)
+        string(REPLACE "|" ";" command "${command}")
+        execute_process(
+            COMMAND ${command}
+            WORKING_DIRECTORY "${WORK_DIR}"
+            ERROR_VARIABLE REPORT
+            RESULT_VARIABLE RESULT
+        )
+        if (NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "Compilation failed:\n${REPORT}")
+        endif ()
+    endforeach ()
+    string(TIMESTAMP END "%s%f" UTC)
+
+    math(EXPR ELAPSED_MS "(${END} - ${BEGIN}) / 1000")
+    set(ELAPSED_MS ${ELAPSED_MS} PARENT_SCOPE)
+endfunction ()
+
+# Sets `BEST_MS` in the parent scope.
+function (run_best)
+    set(BEST -1)
+    foreach (repetition RANGE 1 ${REPETITIONS})
+        run_timed(${ARGN})
+        if (BEST LESS 0 OR ELAPSED_MS LESS BEST)
+            set(BEST ${ELAPSED_MS})
+        endif ()
+    endforeach ()
+    set(BEST_MS ${BEST} PARENT_SCOPE)
+endfunction ()
+
+# Joins the arguments into a single command, which can be passed to `run_best`.
+function (make_command out)
+    list(JOIN ARGN "|" command)
+    set(${out} "${command}" PARENT_SCOPE)
+endfunction ()
+
+set(COMMAND "${COMPILER}" "-std=c++${STANDARD}" "-I${INCLUDE_DIR}")
+if (COMPILER_ID STREQUAL "GNU")
+    # gcc writes the compiled module interfaces into the gcm.cache directory of the working directory.
+    list(APPEND COMMAND -fmodules-ts)
+    make_command(CORE_INTERFACE ${COMMAND} -c -x c++ "${MODULE_DIR}/gimo.cppm" -o gimo.o)
+    make_command(EXT_INTERFACE ${COMMAND} -c -x c++ "${MODULE_DIR}/gimo.ext.std_optional.cppm" -o gimo.ext.std_optional.o)
+    set(MODULE_COMMAND ${COMMAND})
+elseif (COMPILER_ID MATCHES "Clang")
+    make_command(CORE_INTERFACE ${COMMAND} --precompile -x c++-module "${MODULE_DIR}/gimo.cppm" -o gimo.pcm)
+    make_command(EXT_INTERFACE ${COMMAND} -fmodule-file=gimo=gimo.pcm
+        --precompile -x c++-module "${MODULE_DIR}/gimo.ext.std_optional.cppm" -o gimo.ext.std_optional.pcm)
+    set(MODULE_COMMAND ${COMMAND}
+        -fmodule-file=gimo=gimo.pcm
+        -fmodule-file=gimo.ext.std_optional=gimo.ext.std_optional.pcm
+    )
+else ()
+    message(FATAL_ERROR "Unsupported compiler: ${COMPILER_ID}")
+endif ()
+
+make_command(HEADER_CONSUMER ${COMMAND} -c "${SOURCE}" -o consumer-header.o)
+make_command(MODULE_CONSUMER ${MODULE_COMMAND} -DGIMO_COMPILE_BENCHMARK_MODULES -c "${SOURCE}" -o consumer-module.o)
+
+file(MAKE_DIRECTORY "${WORK_DIR}")
+
+# The interfaces must be built one after another, as the extension imports the core module.
+run_best("${CORE_INTERFACE}" "${EXT_INTERFACE}")
+set(INTERFACES_MS ${BEST_MS})
+run_best("${HEADER_CONSUMER}")
+set(HEADER_MS ${BEST_MS})
+run_best("${MODULE_CONSUMER}")
+set(MODULE_MS ${BEST_MS})
+
+set(ENTRIES "")
+foreach (case IN ITEMS "header/consumer;${HEADER_MS}" "module/interfaces;${INTERFACES_MS}" "module/consumer;${MODULE_MS}")
+    list(GET case 0 NAME)
+    list(GET case 1 MS)
+    message(STATUS "${NAME}: ${MS} ms")
+    list(APPEND ENTRIES
+        "    {\"name\": \"${NAME}\", \"run_name\": \"${NAME}\", \"run_type\": \"iteration\", \"repetitions\": ${REPETITIONS}, \"threads\": 1, \"iterations\": 1, \"real_time\": ${MS}, \"cpu_time\": ${MS}, \"time_unit\": \"ms\"}"
+    )
+endforeach ()
+
+string(TIMESTAMP DATE "%Y-%m-%dT%H:%M:%S")
+list(JOIN ENTRIES ",\n" BENCHMARKS)
+file(WRITE "${OUTPUT}"
+    "{\n"
+    "  \"context\": {\"date\": \"${DATE}\", \"executable\": \"gimo-module-compile-benchmarks\", \"compiler\": \"${COMPILER_ID}\", \"cxx_standard\": ${STANDARD}},\n"
+    "  \"benchmarks\": [\n${BENCHMARKS}\n  ]\n"
+    "}\n"
+)
+message(STATUS "Results written to ${OUTPUT}")
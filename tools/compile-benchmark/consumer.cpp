@@ -0,0 +1,27 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// A typical consumer of gimo, which either includes the headers or, if GIMO_COMPILE_BENCHMARK_MODULES is defined,
+// imports the `gimo.ext.std_optional` module.
+
+#include <optional>
+#include <string>
+
+#ifdef GIMO_COMPILE_BENCHMARK_MODULES
+import gimo.ext.std_optional;
+#else
+    #include "gimo.hpp"
+    #include "gimo_ext/std_optional.hpp"
+#endif
+
+std::optional<std::string> compile_benchmark_consumer(std::optional<int> const& opt)
+{
+    constexpr auto pipeline = gimo::and_then([](int const value) { return 0 <= value ? std::optional{value} : std::nullopt; })
+                            | gimo::transform([](int const value) { return 2 * value; })
+                            | gimo::or_else([] { return std::optional{0}; })
+                            | gimo::transform([](int const value) { return std::to_string(value); });
+
+    return gimo::apply(opt, pipeline);
+}
@@ -0,0 +1,113 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// Builds a pipeline of GIMO_COMPILE_BENCHMARK_STEPS distinct steps, which cycle through and_then, transform and or_else,
+// and applies it on the nullable selected by GIMO_COMPILE_BENCHMARK_NULLABLE.
+// The steps are either composed via chained `operator|` or, if GIMO_COMPILE_BENCHMARK_PIPE is defined, via `gimo::pipe`.
+
+#include "gimo/Pipeline.hpp"
+#include "gimo/SentinelOptional.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/std_optional.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#ifndef GIMO_COMPILE_BENCHMARK_STEPS
+    #error "GIMO_COMPILE_BENCHMARK_STEPS must be defined."
+#endif
+
+#define GIMO_COMPILE_BENCHMARK_NULLABLE_optional 1
+#define GIMO_COMPILE_BENCHMARK_NULLABLE_sentinel_optional 2
+#define GIMO_COMPILE_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define GIMO_COMPILE_BENCHMARK_CONCAT(a, b) GIMO_COMPILE_BENCHMARK_CONCAT_IMPL(a, b)
+#define GIMO_COMPILE_BENCHMARK_NULLABLE_ID \
+    GIMO_COMPILE_BENCHMARK_CONCAT(GIMO_COMPILE_BENCHMARK_NULLABLE_, GIMO_COMPILE_BENCHMARK_NULLABLE)
+
+namespace
+{
+#if GIMO_COMPILE_BENCHMARK_NULLABLE_ID == GIMO_COMPILE_BENCHMARK_NULLABLE_optional
+    using nullable_t = std::optional<int>;
+#elif GIMO_COMPILE_BENCHMARK_NULLABLE_ID == GIMO_COMPILE_BENCHMARK_NULLABLE_sentinel_optional
+    using nullable_t = gimo::sentinel_optional<unsigned, std::numeric_limits<unsigned>::max()>;
+#else
+    #error "GIMO_COMPILE_BENCHMARK_NULLABLE must either be optional or sentinel_optional."
+#endif
+
+    using value_t = typename nullable_t::value_type;
+
+    template <std::size_t index>
+    struct and_then_step
+    {
+        [[nodiscard]]
+        constexpr nullable_t operator()(value_t const value) const noexcept
+        {
+            return nullable_t{static_cast<value_t>(value + 1)};
+        }
+    };
+
+    template <std::size_t index>
+    struct transform_step
+    {
+        [[nodiscard]]
+        constexpr value_t operator()(value_t const value) const noexcept
+        {
+            return static_cast<value_t>(value + index);
+        }
+    };
+
+    // Transforms rebind the nullable, thus or_else must yield that one instead.
+    using rebound_t = gimo::rebind_value_t<nullable_t, value_t>;
+
+    template <std::size_t index>
+    struct or_else_step
+    {
+        [[nodiscard]]
+        constexpr rebound_t operator()() const noexcept
+        {
+            return rebound_t{value_t{index}};
+        }
+    };
+
+    template <std::size_t index>
+    [[nodiscard]]
+    constexpr auto make_step()
+    {
+        if constexpr (0u == index % 3u)
+        {
+            return gimo::and_then(and_then_step<index>{});
+        }
+        else if constexpr (1u == index % 3u)
+        {
+            return gimo::transform(transform_step<index>{});
+        }
+        else
+        {
+            return gimo::or_else(or_else_step<index>{});
+        }
+    }
+
+    template <std::size_t... indices>
+    [[nodiscard]]
+    constexpr auto make_pipeline([[maybe_unused]] std::index_sequence<indices...> const sequence)
+    {
+#ifdef GIMO_COMPILE_BENCHMARK_PIPE
+        return gimo::pipe(make_step<indices>()...);
+#else
+        return (make_step<indices>() | ...);
+#endif
+    }
+}
+
+auto compile_benchmark_case(nullable_t const& opt)
+{
+    constexpr auto pipeline = make_pipeline(std::make_index_sequence<GIMO_COMPILE_BENCHMARK_STEPS>{});
+
+    return std::pair{pipeline.apply(opt), gimo::apply(nullable_t{opt}, pipeline)};
+}